@@ -3235,6 +3235,11 @@ future<executor::request_return_type> executor::batch_get_item(client_state& cli
     // requests for the different partitions all in parallel.
     std::vector<future<std::vector<rjson::value>>> response_futures;
     for (const auto& rs : requests) {
+        // The column set and selection are per-table state; compute them
+        // once here instead of once per queried partition.
+        auto regular_columns = boost::copy_range<query::column_id_vector>(
+                rs.schema->regular_columns() | boost::adaptors::transformed([] (const column_definition& cdef) { return cdef.id; }));
+        auto selection = cql3::selection::selection::wildcard(rs.schema);
         for (const auto &r : rs.requests) {
             auto& pk = r.first;
             auto& cks = r.second;
@@ -3247,14 +3252,11 @@ future<executor::request_return_type> executor::batch_get_item(client_state& cli
                     bounds.push_back(query::clustering_range::make_singular(ck.first));
                 }
             }
-            auto regular_columns = boost::copy_range<query::column_id_vector>(
-                    rs.schema->regular_columns() | boost::adaptors::transformed([] (const column_definition& cdef) { return cdef.id; }));
-            auto selection = cql3::selection::selection::wildcard(rs.schema);
-            auto partition_slice = query::partition_slice(std::move(bounds), {}, std::move(regular_columns), selection->get_query_options());
+            auto partition_slice = query::partition_slice(std::move(bounds), {}, query::column_id_vector(regular_columns), selection->get_query_options());
             auto command = ::make_lw_shared<query::read_command>(rs.schema->id(), rs.schema->version(), partition_slice, _proxy.get_max_result_size(partition_slice));
             future<std::vector<rjson::value>> f = _proxy.query(rs.schema, std::move(command), std::move(partition_ranges), rs.cl,
                     service::storage_proxy::coordinator_query_options(executor::default_timeout(), permit, client_state, trace_state)).then(
-                    [schema = rs.schema, partition_slice = std::move(partition_slice), selection = std::move(selection), attrs_to_get = rs.attrs_to_get] (service::storage_proxy::coordinator_query_result qr) mutable {
+                    [schema = rs.schema, partition_slice = std::move(partition_slice), selection, attrs_to_get = rs.attrs_to_get] (service::storage_proxy::coordinator_query_result qr) mutable {
                 utils::get_local_injector().inject("alternator_batch_get_item", [] { throw std::runtime_error("batch_get_item injection"); });
                 std::vector<rjson::value> jsons = describe_multi_item(schema, partition_slice, *selection, *qr.query_result, *attrs_to_get);
                 return make_ready_future<std::vector<rjson::value>>(std::move(jsons));
@@ -3466,7 +3468,10 @@ class describe_items_visitor {
     const filter& _filter;
     typename columns_t::const_iterator _column_it;
     rjson::value _item;
-    rjson::value _items;
+    // Items which passed the filter, each already serialized to its JSON
+    // representation. Serializing items as soon as they are complete means
+    // only one item's DOM is alive at any moment, instead of a whole page's.
+    std::vector<std::string> _items;
     size_t _scanned_count;
 
 public:
@@ -3476,7 +3481,6 @@ public:
             , _filter(filter)
             , _column_it(columns.begin())
             , _item(rjson::empty_object())
-            , _items(rjson::empty_array())
             , _scanned_count(0)
     {
         // _filter.check() may need additional attributes not listed in
@@ -3555,13 +3559,13 @@ public:
                 rjson::remove_member(_item, attr);
             }
 
-            rjson::push_back(_items, std::move(_item));
+            _items.push_back(rjson::print(_item));
         }
         _item = rjson::empty_object();
         ++_scanned_count;
     }
 
-    rjson::value get_items() && {
+    std::vector<std::string> get_items() && {
         return std::move(_items);
     }
 
@@ -3570,15 +3574,10 @@ public:
     }
 };
 
-static std::tuple<rjson::value, size_t> describe_items(schema_ptr schema, const query::partition_slice& slice, const cql3::selection::selection& selection, std::unique_ptr<cql3::result_set> result_set, std::optional<attrs_to_get>&& attrs_to_get, filter&& filter) {
-    describe_items_visitor visitor(selection.get_columns(), attrs_to_get, filter);
-    result_set->visit(visitor);
-    auto scanned_count = visitor.get_scanned_count();
-    rjson::value items = std::move(visitor).get_items();
-    rjson::value items_descr = rjson::empty_object();
-    auto size = items.Size();
-    rjson::add(items_descr, "Count", rjson::value(size));
-    rjson::add(items_descr, "ScannedCount", rjson::value(scanned_count));
+struct described_items {
+    // Each element is one item, already serialized to JSON.
+    std::vector<std::string> items;
+    size_t scanned_count;
     // If attrs_to_get && attrs_to_get->empty(), this means the user asked not
     // to get any attributes (i.e., a Scan or Query with Select=COUNT) and we
     // shouldn't return "Items" at all.
@@ -3586,10 +3585,94 @@ static std::tuple<rjson::value, size_t> describe_items(schema_ptr schema, const
     // In that case, we currently build a list of empty items and here drop
     // it. We could just count the items and not bother with the empty items.
     // (However, remember that when we do have a filter, we need the items).
-    if (!attrs_to_get || !attrs_to_get->empty()) {
-        rjson::add(items_descr, "Items", std::move(items));
-    }
-    return {std::move(items_descr), size};
+    bool include_items;
+};
+
+static described_items describe_items(schema_ptr schema, const query::partition_slice& slice, const cql3::selection::selection& selection, std::unique_ptr<cql3::result_set> result_set, std::optional<attrs_to_get>&& attrs_to_get, filter&& filter) {
+    describe_items_visitor visitor(selection.get_columns(), attrs_to_get, filter);
+    result_set->visit(visitor);
+    auto scanned_count = visitor.get_scanned_count();
+    return described_items{std::move(visitor).get_items(), scanned_count, !attrs_to_get || !attrs_to_get->empty()};
+}
+
+// Assemble the response for a Query or Scan around pre-serialized items.
+// Small responses are returned as one contiguous JSON string; large ones are
+// written straight into the HTTP output stream, releasing each item as soon
+// as it is written, so the response never has to exist in memory in one
+// piece.
+static executor::request_return_type make_items_response(described_items&& items, std::optional<std::string>&& last_evaluated_key) {
+    auto append_envelope = [] (auto&& write, described_items& items, const std::optional<std::string>& last_evaluated_key) {
+        write("{\"Count\":");
+        write(std::to_string(items.items.size()));
+        write(",\"ScannedCount\":");
+        write(std::to_string(items.scanned_count));
+        if (items.include_items) {
+            write(",\"Items\":[");
+            bool first = true;
+            for (auto& item : items.items) {
+                if (!std::exchange(first, false)) {
+                    write(",");
+                }
+                write(item);
+            }
+            write("]");
+        }
+        if (last_evaluated_key) {
+            write(",\"LastEvaluatedKey\":");
+            write(*last_evaluated_key);
+        }
+        write("}");
+    };
+    // TODO: better threshold
+    if (items.items.size() <= 10) {
+        std::string body;
+        append_envelope([&body] (std::string_view s) { body.append(s); }, items, last_evaluated_key);
+        return json_string(std::move(body));
+    }
+    struct response_state {
+        described_items items;
+        std::optional<std::string> last_evaluated_key;
+    };
+    auto state = make_shared<response_state>(response_state{std::move(items), std::move(last_evaluated_key)});
+    std::function<future<>(output_stream<char>&&)> func = [state] (output_stream<char>&& os) mutable -> future<> {
+        // move objects to coroutine frame.
+        auto los = std::move(os);
+        auto lstate = std::move(state);
+        try {
+            std::string header = "{\"Count\":" + std::to_string(lstate->items.items.size())
+                    + ",\"ScannedCount\":" + std::to_string(lstate->items.scanned_count);
+            co_await los.write(header.data(), header.size());
+            if (lstate->items.include_items) {
+                co_await los.write(",\"Items\":[", 10);
+                bool first = true;
+                for (auto& item : lstate->items.items) {
+                    if (!std::exchange(first, false)) {
+                        co_await los.write(",", 1);
+                    }
+                    co_await los.write(item.data(), item.size());
+                    // Free each item as soon as it has been written.
+                    item = {};
+                }
+                co_await los.write("]", 1);
+            }
+            if (lstate->last_evaluated_key) {
+                co_await los.write(",\"LastEvaluatedKey\":", 20);
+                co_await los.write(lstate->last_evaluated_key->data(), lstate->last_evaluated_key->size());
+            }
+            co_await los.write("}", 1);
+            co_await los.flush();
+            co_await los.close();
+        } catch (...) {
+            // at this point, we cannot really do anything. HTTP headers and return code are
+            // already written, and quite potentially a portion of the content data.
+            // just log + rethrow. It is probably better the HTTP server closes connection
+            // abruptly or something...
+            elogger.error("Unhandled exception in data streaming: {}", std::current_exception());
+            throw;
+        }
+        co_return;
+    };
+    return json::json_return_type(std::move(func));
 }
 
 static rjson::value encode_paging_state(const schema& schema, const service::pager::paging_state& paging_state) {
@@ -3672,20 +3755,17 @@ static future<executor::request_return_type> do_query(service::storage_proxy& pr
         }
         auto paging_state = rs->get_metadata().paging_state();
         bool has_filter = filter;
-        auto [items, size] = describe_items(schema, partition_slice, *selection, std::move(rs), std::move(attrs_to_get), std::move(filter));
+        auto items = describe_items(schema, partition_slice, *selection, std::move(rs), std::move(attrs_to_get), std::move(filter));
+        std::optional<std::string> last_evaluated_key;
         if (paging_state) {
-            rjson::add(items, "LastEvaluatedKey", encode_paging_state(*schema, *paging_state));
+            last_evaluated_key = rjson::print(encode_paging_state(*schema, *paging_state));
         }
         if (has_filter){
             cql_stats.filtered_rows_read_total += p->stats().rows_read_total;
             // update our "filtered_row_matched_total" for all the rows matched, despited the filter
-            cql_stats.filtered_rows_matched_total += size;
-        }
-        // TODO: better threshold
-        if (size > 10) {
-            return make_ready_future<executor::request_return_type>(make_streamed(std::move(items)));
+            cql_stats.filtered_rows_matched_total += items.items.size();
         }
-        return make_ready_future<executor::request_return_type>(make_jsonable(std::move(items)));
+        return make_ready_future<executor::request_return_type>(make_items_response(std::move(items), std::move(last_evaluated_key)));
     });
 }
 
@@ -24,6 +24,7 @@
 #include <boost/algorithm/cxx11/all_of.hpp>
 
 #include <functional>
+#include <list>
 #include <unordered_map>
 
 namespace alternator {
@@ -43,10 +44,54 @@ Result do_with_parser(std::string_view input, Func&& f) {
     return result;
 }
 
+// Applications usually send a small fixed set of distinct expression
+// strings (with the variable parts in ExpressionAttributeNames/Values),
+// so keep a per-shard LRU cache of parse results per expression type.
+// The cached AST stays pristine - callers get a copy, which they may
+// then modify by resolving the attribute references in it. The parsed
+// types were already made copyable for ANTLR's sake (see the comment on
+// parsed::constant), and resolving replaces parts of the copy instead of
+// writing through anything shared with the cached original.
+template <typename Parsed>
+class expression_cache {
+    struct entry {
+        std::string text;
+        Parsed parsed;
+    };
+    // Recently-used entries are at the front of the list. The index refers
+    // to the strings stored in the list nodes, which don't move.
+    std::list<entry> _lru;
+    std::unordered_map<std::string_view, typename std::list<entry>::iterator> _index;
+    // Enough for the handful of distinct expressions real applications
+    // send, while bounding the memory wasted on ones which never repeat.
+    static constexpr size_t max_entries = 256;
+public:
+    template <typename ParseFn>
+    Parsed get(std::string_view text, ParseFn&& parse) {
+        auto i = _index.find(text);
+        if (i != _index.end()) {
+            _lru.splice(_lru.begin(), _lru, i->second);
+            return i->second->parsed;
+        }
+        // Parse failures throw and are not cached.
+        Parsed p = parse(text);
+        _lru.push_front(entry{std::string(text), p});
+        _index.emplace(_lru.front().text, _lru.begin());
+        if (_index.size() > max_entries) {
+            _index.erase(_lru.back().text);
+            _lru.pop_back();
+        }
+        return p;
+    }
+};
+
 parsed::update_expression
 parse_update_expression(std::string_view query) {
+    static thread_local expression_cache<parsed::update_expression> cache;
     try {
-        return do_with_parser(query,  std::mem_fn(&expressionsParser::update_expression));
+        return cache.get(query, [] (std::string_view q) {
+            return do_with_parser(q, std::mem_fn(&expressionsParser::update_expression));
+        });
     } catch (...) {
         throw expressions_syntax_error(format("Failed parsing UpdateExpression '{}': {}", query, std::current_exception()));
     }
@@ -54,8 +99,11 @@ parse_update_expression(std::string_view query) {
 
 std::vector<parsed::path>
 parse_projection_expression(std::string_view query) {
+    static thread_local expression_cache<std::vector<parsed::path>> cache;
     try {
-        return do_with_parser(query,  std::mem_fn(&expressionsParser::projection_expression));
+        return cache.get(query, [] (std::string_view q) {
+            return do_with_parser(q, std::mem_fn(&expressionsParser::projection_expression));
+        });
     } catch (...) {
         throw expressions_syntax_error(format("Failed parsing ProjectionExpression '{}': {}", query, std::current_exception()));
     }
@@ -63,8 +111,11 @@ parse_projection_expression(std::string_view query) {
 
 parsed::condition_expression
 parse_condition_expression(std::string_view query) {
+    static thread_local expression_cache<parsed::condition_expression> cache;
     try {
-        return do_with_parser(query,  std::mem_fn(&expressionsParser::condition_expression));
+        return cache.get(query, [] (std::string_view q) {
+            return do_with_parser(q, std::mem_fn(&expressionsParser::condition_expression));
+        });
     } catch (...) {
         throw expressions_syntax_error(format("Failed parsing ConditionExpression '{}': {}", query, std::current_exception()));
     }
@@ -58,6 +58,13 @@ protected:
     std::vector<control_point> _control_points;
 
     std::function<float()> _current_backlog;
+    // When non-zero, the backlog growth since the previous adjustment is
+    // multiplied by this gain and added to the backlog before interpolating,
+    // so shares ramp up while a burst is still filling up instead of after
+    // the thresholds are crossed. Shrinking backlog is not extrapolated to
+    // avoid starving the controlled work while it still has a backlog.
+    float _derivative_gain = 0.0f;
+    float _last_backlog = 0.0f;
     // updating shares for an I/O class may contact another shard and returns a future.
     future<> _inflight_update;
 
@@ -112,12 +119,14 @@ class flush_controller : public backlog_controller {
     static constexpr float hard_dirty_limit = 1.0f;
 public:
     flush_controller(backlog_controller::scheduling_group& sg, float static_shares) : backlog_controller(sg, static_shares) {}
-    flush_controller(backlog_controller::scheduling_group& sg, std::chrono::milliseconds interval, float soft_limit, std::function<float()> current_dirty)
+    flush_controller(backlog_controller::scheduling_group& sg, std::chrono::milliseconds interval, float soft_limit, std::function<float()> current_dirty, float derivative_gain = 0.0f)
         : backlog_controller(sg, std::move(interval),
           std::vector<backlog_controller::control_point>({{0.0, 0.0}, {soft_limit, 10}, {soft_limit + (hard_dirty_limit - soft_limit) / 2, 200} , {hard_dirty_limit, 1000}}),
           std::move(current_dirty)
         )
-    {}
+    {
+        _derivative_gain = derivative_gain;
+    }
 };
 
 class compaction_controller : public backlog_controller {
@@ -318,8 +318,14 @@ public:
         return _size == 0;
     }
 
+    // Hints at the total amount of data that will be written, so that it can
+    // be allocated in a few large chunks instead of growing from the default
+    // chunk size. Effective only before the first write; a single chunk never
+    // exceeds max_chunk_size() regardless of the hint.
     void reserve(size_t size) {
-        // FIXME: implement
+        if (!_current) {
+            _initial_chunk_size = std::clamp<size_t>(size + sizeof(chunk), default_chunk_size, max_alloc_size());
+        }
     }
 
     void append(const bytes_ostream& o) {
@@ -124,6 +124,13 @@ private:
         column_id id;
     };
 
+    // Non-owning counterpart of cell_address, used as a look-up key so that
+    // probing the lock table does not copy the clustering key of every cell.
+    struct cell_address_view {
+        position_in_partition_view position;
+        column_id id;
+    };
+
     class cell_entry : public bi::unordered_set_base_hook<bi::link_mode<bi::auto_unlink>>,
                        public enable_lw_shared_from_this<cell_entry> {
         partition_entry& _parent;
@@ -180,6 +187,9 @@ private:
             explicit hasher(const schema& s) : _schema(&s) { }
 
             size_t operator()(const cell_address& ca) const {
+                return operator()(cell_address_view { ca.position, ca.id });
+            }
+            size_t operator()(const cell_address_view& ca) const {
                 xx_hasher hasher;
                 ca.position.feed_hash(hasher, *_schema);
                 ::feed_hash(hasher, ca.id);
@@ -193,19 +203,19 @@ private:
         class equal_compare {
             position_in_partition::equal_compare _cmp;
         private:
-            bool do_compare(const cell_address& a, const cell_address& b) const {
+            bool do_compare(const cell_address_view& a, const cell_address& b) const {
                 return a.id == b.id && _cmp(a.position, b.position);
             }
         public:
             explicit equal_compare(const schema& s) : _cmp(s) { }
-            bool operator()(const cell_address& ca, const cell_entry& ce) const {
+            bool operator()(const cell_address_view& ca, const cell_entry& ce) const {
                 return do_compare(ca, ce._address);
             }
-            bool operator()(const cell_entry& ce, const cell_address& ca) const {
+            bool operator()(const cell_entry& ce, const cell_address_view& ca) const {
                 return do_compare(ca, ce._address);
             }
             bool operator()(const cell_entry& a, const cell_entry& b) const {
-                return do_compare(a._address, b._address);
+                return do_compare(cell_address_view { a._address.position, a._address.id }, b._address);
             }
         };
     };
@@ -482,7 +492,9 @@ future<> cell_locker::locker::lock_next() {
 
         auto cid = *_current_cell++;
 
-        cell_address ca { position_in_partition(_current_ck->position()), cid };
+        // Probe with a view first; the position is materialized only when a
+        // new cell_entry is actually inserted.
+        cell_address_view ca { _current_ck->position(), cid };
         auto it = _partition_entry.cells().find(ca, _hasher, _eq_cmp);
         if (it != _partition_entry.cells().end()) {
             _stats.operations_waiting_for_lock++;
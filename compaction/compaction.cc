@@ -29,6 +29,7 @@
 
 #include "sstables/sstables.hh"
 #include "sstables/sstable_writer.hh"
+#include "sstables/hyperloglog.hh"
 #include "sstables/progress_monitor.hh"
 #include "sstables/sstables_manager.hh"
 #include "compaction.hh"
@@ -49,6 +50,7 @@
 #include "utils/fmt-compat.hh"
 #include "readers/filtering.hh"
 #include "readers/compacting.hh"
+#include "readers/combined.hh"
 #include "tombstone_gc.hh"
 
 namespace sstables {
@@ -449,6 +451,9 @@ protected:
     bool _contains_multi_fragment_runs = false;
     mutation_source_metadata _ms_metadata = {};
     compaction_sstable_replacer_fn _replacer;
+    // If set, produces an extra in-memory input (e.g. a memtable flush reader)
+    // to be merged with the sstable reader.
+    compaction_extra_reader_factory_fn _extra_reader_factory;
     utils::UUID _run_identifier;
     ::io_priority_class _io_priority;
     // optional clone of sstable set to be used for expiration purposes, so it will be set if expiration is enabled.
@@ -478,6 +483,7 @@ protected:
         , _max_sstable_size(descriptor.max_sstable_bytes)
         , _sstable_level(descriptor.level)
         , _replacer(std::move(descriptor.replacer))
+        , _extra_reader_factory(std::move(descriptor.extra_reader_factory))
         , _run_identifier(descriptor.run_identifier)
         , _io_priority(descriptor.io_priority)
         , _sstable_set(std::move(descriptor.all_sstables_snapshot))
@@ -624,6 +630,30 @@ private:
         auto fully_expired = _table_s.fully_expired_sstables(_sstables, gc_clock::now());
         min_max_tracker<api::timestamp_type> timestamp_tracker;
 
+        // Merged cardinality sketch across the input sstables. The union
+        // estimate accounts for partitions present in several inputs, unlike
+        // the sum of the per-sstable key counts, so it doesn't oversize the
+        // output bloom filter and summary when the inputs overlap heavily.
+        std::optional<hll::HyperLogLog> merged_cardinality;
+        bool use_cardinality = true;
+        auto merge_cardinality = [&] (const shared_sstable& sst) {
+            try {
+                auto& cm = sst->get_compaction_metadata();
+                temporary_buffer<uint8_t> buf(cm.cardinality.elements.size());
+                std::copy(cm.cardinality.elements.begin(), cm.cardinality.elements.end(), buf.get_write());
+                auto sketch = hll::HyperLogLog::from_bytes(std::move(buf));
+                if (merged_cardinality) {
+                    merged_cardinality->merge(sketch);
+                } else {
+                    merged_cardinality.emplace(std::move(sketch));
+                }
+            } catch (...) {
+                log_debug("Unusable cardinality sketch in {}: {}. Falling back to summary-based partition estimate",
+                          sst->get_filename(), std::current_exception());
+                use_cardinality = false;
+            }
+        };
+
         _input_sstable_generations.reserve(_sstables.size());
         for (auto& sst : _sstables) {
             co_await coroutine::maybe_yield();
@@ -646,9 +676,12 @@ private:
 
             // We also capture the sstable, so we keep it alive while the read isn't done
             ssts->insert(sst);
-            // FIXME: If the sstables have cardinality estimation bitmaps, use that
-            // for a better estimate for the number of partitions in the merged
-            // sstable than just adding up the lengths of individual sstables.
+            if (use_cardinality) {
+                merge_cardinality(sst);
+            }
+            // Keep the additive estimate as a fallback in case an input lacks
+            // a usable sketch (e.g. written before sketches used p=13 and
+            // thus with a different register count).
             _estimated_partitions += sst->get_estimated_key_count();
             // TODO:
             // Note that this is not fully correct. Since we might be merging sstables that originated on
@@ -659,6 +692,14 @@ private:
             // compacted sstables anyway (CL should be clean by then).
             _rp = std::max(_rp, sst_stats.position);
         }
+        if (use_cardinality && merged_cardinality) {
+            // The sum of the per-sstable key counts is an upper bound on the
+            // number of unique partitions, so cap the union estimate with it.
+            auto estimate = std::max<uint64_t>(1, uint64_t(merged_cardinality->estimate()));
+            log_debug("Estimated {} unique partitions from merged cardinality sketches (summary-based upper bound: {})",
+                      estimate, _estimated_partitions);
+            _estimated_partitions = std::min(_estimated_partitions, estimate);
+        }
         log_info("{} {}", report_start_desc(), formatted_msg);
         if (ssts->all()->size() < _sstables.size()) {
             log_debug("{} out of {} input sstables are fully expired sstables that will not be actually compacted",
@@ -947,7 +988,7 @@ public:
     }
 
     flat_mutation_reader_v2 make_sstable_reader() const override {
-        return _compacting->make_local_shard_sstable_reader(_schema,
+        auto reader = _compacting->make_local_shard_sstable_reader(_schema,
                 _permit,
                 query::full_partition_range,
                 _schema->full_slice(),
@@ -956,6 +997,13 @@ public:
                 ::streamed_mutation::forwarding::no,
                 ::mutation_reader::forwarding::no,
                 _monitor_generator);
+        if (_extra_reader_factory) {
+            reader = make_combined_reader(_schema, _permit, std::move(reader),
+                    _extra_reader_factory(_schema, _permit, _io_priority),
+                    ::streamed_mutation::forwarding::no,
+                    ::mutation_reader::forwarding::no);
+        }
+        return reader;
     }
 
     std::string_view report_start_desc() const override {
@@ -19,6 +19,8 @@
 #include "utils/UUID.hh"
 #include "dht/i_partitioner.hh"
 #include "compaction_weight_registration.hh"
+#include "readers/flat_mutation_reader_fwd.hh"
+#include "reader_permit.hh"
 
 namespace sstables {
 
@@ -48,6 +50,9 @@ struct compaction_completion_desc {
 using compaction_sstable_creator_fn = std::function<shared_sstable(shard_id shard)>;
 // Replaces old sstable(s) by new one(s) which contain all non-expired data.
 using compaction_sstable_replacer_fn = std::function<void(compaction_completion_desc)>;
+// Creates an extra mutation reader which will be merged with the input sstables,
+// e.g. a flush reader over a memtable being sealed.
+using compaction_extra_reader_factory_fn = std::function<flat_mutation_reader_v2(schema_ptr, reader_permit, const ::io_priority_class&)>;
 
 class compaction_type_options {
 public:
@@ -152,11 +157,25 @@ struct compaction_descriptor {
     compaction_sstable_creator_fn creator;
     compaction_sstable_replacer_fn replacer;
 
+    // Optional reader over data which only exists in memory, e.g. a memtable
+    // being flushed. When set, regular compaction merges it with the input
+    // sstables, so the flush output and the first-round compaction output are
+    // produced in a single write pass instead of sealing an L0 sstable only to
+    // re-read and rewrite it moments later. The caller remains responsible for
+    // keeping the underlying memtable alive and discardable-from-commitlog
+    // only after the compaction output is sealed.
+    compaction_extra_reader_factory_fn extra_reader_factory;
+
     ::io_priority_class io_priority = default_priority_class();
 
     // Denotes if this compaction task is comprised solely of completely expired SSTables
     sstables::has_only_fully_expired has_only_fully_expired = has_only_fully_expired::no;
 
+    // Denotes a job whose single input sstable overlaps nothing in the target
+    // level, so it can be promoted by mutating its level metadata in place
+    // instead of being rewritten. Only regular leveled compaction sets this.
+    bool metadata_only_level_promotion = false;
+
     compaction_descriptor() = default;
 
     static constexpr int default_level = 0;
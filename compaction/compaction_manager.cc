@@ -141,7 +141,7 @@ static inline int calculate_weight(uint64_t total_size) {
 static inline int calculate_weight(const sstables::compaction_descriptor& descriptor) {
     // Use weight 0 for compactions that are comprised solely of completely expired sstables.
     // We want these compactions to be in a separate weight class because they are very lightweight, fast and efficient.
-    if (descriptor.sstables.empty() || descriptor.has_only_fully_expired) {
+    if (descriptor.sstables.empty() || descriptor.has_only_fully_expired || descriptor.metadata_only_level_promotion) {
         return 0;
     }
     return calculate_weight(descriptor.sstables_size());
@@ -878,6 +878,29 @@ protected:
             cmlog.debug("Accepted compaction job: task={} ({} sstable(s)) of weight {} for {}.{}",
                 fmt::ptr(this), descriptor.sstables.size(), weight, t.schema()->ks_name(), t.schema()->cf_name());
 
+            if (descriptor.metadata_only_level_promotion) {
+                // The input overlaps nothing in the target level, so a rewrite
+                // would reproduce it verbatim one level down. Promote it by
+                // mutating the level in its metadata instead; the sstable set
+                // doesn't index by level, so no replacement is needed there.
+                auto sst = descriptor.sstables.front();
+                cmlog.debug("Promoting {} from L{} to L{} without rewriting it", sst->get_filename(), sst->get_sstable_level(), descriptor.level);
+                // Same removed/added shape a one-input rewrite would produce,
+                // advancing the strategy's round-robin cursor at the old level.
+                t.get_compaction_strategy().notify_completion(descriptor.sstables, descriptor.sstables);
+                // The backlog tracker charges an sstable against the level read
+                // from its metadata, so revert the charges before the mutation
+                // and re-apply them afterwards.
+                auto& tracker = t.get_compaction_strategy().get_backlog_tracker();
+                tracker.replace_sstables(descriptor.sstables, {});
+                auto readd_charges = defer([&] {
+                    tracker.replace_sstables({}, descriptor.sstables);
+                });
+                co_await sst->mutate_sstable_level(descriptor.level);
+                _cm.reevaluate_postponed_compactions();
+                continue;
+            }
+
             setup_new_compaction(descriptor.run_identifier);
             std::exception_ptr ex;
 
@@ -27,6 +27,11 @@ compaction_descriptor leveled_compaction_strategy::get_sstables_for_compaction(t
     auto candidate = manifest.get_compaction_candidates(*_last_compacted_keys, _compaction_counter);
 
     if (!candidate.sstables.empty()) {
+        // Don't promote by metadata mutation if the rewrite we'd be skipping would
+        // purge a meaningful amount of droppable tombstones.
+        if (candidate.metadata_only_level_promotion && worth_dropping_tombstones(candidate.sstables.front(), gc_clock::now())) {
+            candidate.metadata_only_level_promotion = false;
+        }
         leveled_manifest::logger.debug("leveled: Compacting {} out of {} sstables", candidate.sstables.size(), table_s.get_sstable_set().all()->size());
         return candidate;
     }
@@ -149,8 +149,18 @@ public:
             if (info.can_promote) {
                 info.candidates = get_overlapping_starved_sstables(next_level, std::move(info.candidates), compaction_counter);
             }
-            return sstables::compaction_descriptor(std::move(info.candidates),
-                                                   service::get_local_compaction_priority(), next_level, _max_sstable_size_in_bytes);
+            auto descriptor = sstables::compaction_descriptor(std::move(info.candidates),
+                                                              service::get_local_compaction_priority(), next_level, _max_sstable_size_in_bytes);
+            // A single input whose key range overlaps nothing in the target level
+            // would be rewritten verbatim one level down. Let the compaction
+            // manager promote it by mutating its level metadata instead, unless
+            // it is oversized and the rewrite would split it.
+            if (descriptor.sstables.size() == 1 && info.can_promote
+                    && next_level == int(descriptor.sstables.front()->get_sstable_level()) + 1
+                    && descriptor.sstables.front()->ondisk_data_size() <= _max_sstable_size_in_bytes) {
+                descriptor.metadata_only_level_promotion = true;
+            }
+            return descriptor;
         } else {
             logger.debug("No compaction candidates for L{}", level);
             return sstables::compaction_descriptor();
@@ -28,6 +28,9 @@ size_tiered_compaction_strategy_options::size_tiered_compaction_strategy_options
 
     tmp_value = compaction_strategy_impl::get_value(options, COLD_READS_TO_OMIT_KEY);
     cold_reads_to_omit = property_definitions::to_double(COLD_READS_TO_OMIT_KEY, tmp_value, DEFAULT_COLD_READS_TO_OMIT);
+
+    tmp_value = compaction_strategy_impl::get_value(options, SSTABLE_SIZE_KEY);
+    sstable_size_in_mb = property_definitions::to_long(SSTABLE_SIZE_KEY, tmp_value, DEFAULT_SSTABLE_SIZE_IN_MB);
 }
 
 size_tiered_compaction_strategy_options::size_tiered_compaction_strategy_options() {
@@ -35,6 +38,7 @@ size_tiered_compaction_strategy_options::size_tiered_compaction_strategy_options
     bucket_low = DEFAULT_BUCKET_LOW;
     bucket_high = DEFAULT_BUCKET_HIGH;
     cold_reads_to_omit = DEFAULT_COLD_READS_TO_OMIT;
+    sstable_size_in_mb = DEFAULT_SSTABLE_SIZE_IN_MB;
 }
 
 std::vector<std::pair<sstables::shared_sstable, uint64_t>>
@@ -154,13 +158,15 @@ size_tiered_compaction_strategy::get_sstables_for_compaction(table_state& table_
 
     if (is_any_bucket_interesting(buckets, min_threshold)) {
         std::vector<sstables::shared_sstable> most_interesting = most_interesting_bucket(std::move(buckets), min_threshold, max_threshold);
-        return sstables::compaction_descriptor(std::move(most_interesting), service::get_local_compaction_priority());
+        return sstables::compaction_descriptor(std::move(most_interesting), service::get_local_compaction_priority(),
+                compaction_descriptor::default_level, _options.max_sstable_bytes());
     }
 
     // If we are not enforcing min_threshold explicitly, try any pair of SStables in the same tier.
     if (!table_s.compaction_enforce_min_threshold() && is_any_bucket_interesting(buckets, 2)) {
         std::vector<sstables::shared_sstable> most_interesting = most_interesting_bucket(std::move(buckets), 2, max_threshold);
-        return sstables::compaction_descriptor(std::move(most_interesting), service::get_local_compaction_priority());
+        return sstables::compaction_descriptor(std::move(most_interesting), service::get_local_compaction_priority(),
+                compaction_descriptor::default_level, _options.max_sstable_bytes());
     }
 
     // if there is no sstable to compact in standard way, try compacting single sstable whose droppable tombstone
@@ -180,7 +186,8 @@ size_tiered_compaction_strategy::get_sstables_for_compaction(table_state& table_
         auto it = std::min_element(sstables.begin(), sstables.end(), [] (auto& i, auto& j) {
             return i->get_stats_metadata().min_timestamp < j->get_stats_metadata().min_timestamp;
         });
-        return sstables::compaction_descriptor({ *it }, service::get_local_compaction_priority());
+        return sstables::compaction_descriptor({ *it }, service::get_local_compaction_priority(),
+                compaction_descriptor::default_level, _options.max_sstable_bytes());
     }
     return sstables::compaction_descriptor();
 }
@@ -240,7 +247,7 @@ size_tiered_compaction_strategy::get_reshaping_job(std::vector<shared_sstable> i
         // All sstables can be reshaped at once if the amount of overlapping will not cause memory usage to be high,
         // which is possible because partitioned set is able to incrementally open sstables during compaction
         if (sstable_set_overlapping_count(schema, input) <= max_sstables) {
-            compaction_descriptor desc(std::move(input), iop);
+            compaction_descriptor desc(std::move(input), iop, compaction_descriptor::default_level, _options.max_sstable_bytes());
             desc.options = compaction_type_options::make_reshape();
             return desc;
         }
@@ -256,7 +263,7 @@ size_tiered_compaction_strategy::get_reshaping_job(std::vector<shared_sstable> i
                 });
                 bucket.resize(max_sstables);
             }
-            compaction_descriptor desc(std::move(bucket), iop);
+            compaction_descriptor desc(std::move(bucket), iop, compaction_descriptor::default_level, _options.max_sstable_bytes());
             desc.options = compaction_type_options::make_reshape();
             return desc;
         }
@@ -284,7 +291,8 @@ size_tiered_compaction_strategy::get_cleanup_compaction_jobs(table_state& table_
             unsigned needed = std::min(remaining, max_threshold);
             std::vector<shared_sstable> sstables;
             std::move(it, it + needed, std::back_inserter(sstables));
-            ret.push_back(compaction_descriptor(std::move(sstables), service::get_local_compaction_priority()));
+            ret.push_back(compaction_descriptor(std::move(sstables), service::get_local_compaction_priority(),
+                    compaction_descriptor::default_level, _options.max_sstable_bytes()));
             std::advance(it, needed);
         }
     }
@@ -22,15 +22,32 @@ class size_tiered_compaction_strategy_options {
     static constexpr double DEFAULT_BUCKET_LOW = 0.5;
     static constexpr double DEFAULT_BUCKET_HIGH = 1.5;
     static constexpr double DEFAULT_COLD_READS_TO_OMIT = 0.05;
+    // 0 disables the output size cap, i.e. a compaction writes a single
+    // sstable regardless of how big the tier is.
+    static constexpr uint64_t DEFAULT_SSTABLE_SIZE_IN_MB = 0;
     const sstring MIN_SSTABLE_SIZE_KEY = "min_sstable_size";
     const sstring BUCKET_LOW_KEY = "bucket_low";
     const sstring BUCKET_HIGH_KEY = "bucket_high";
     const sstring COLD_READS_TO_OMIT_KEY = "cold_reads_to_omit";
+    const sstring SSTABLE_SIZE_KEY = "sstable_size_in_mb";
 
     uint64_t min_sstable_size = DEFAULT_MIN_SSTABLE_SIZE;
     double bucket_low = DEFAULT_BUCKET_LOW;
     double bucket_high = DEFAULT_BUCKET_HIGH;
     double cold_reads_to_omit =  DEFAULT_COLD_READS_TO_OMIT;
+    uint64_t sstable_size_in_mb = DEFAULT_SSTABLE_SIZE_IN_MB;
+
+    // Size threshold the compaction code uses to seal output sstables.
+    // Bounding it makes every compaction emit a run of fixed-size fragments
+    // (sharing the descriptor's run identifier) instead of one tier-sized
+    // sstable, which in turn engages the incremental machinery in
+    // compaction.cc: exhausted input fragments are replaced in the sstable
+    // set and released as soon as their key range has been rewritten,
+    // bounding both the transient space requirement and the granularity of
+    // the I/O a single job produces.
+    uint64_t max_sstable_bytes() const {
+        return sstable_size_in_mb ? sstable_size_in_mb * 1024 * 1024 : compaction_descriptor::default_max_sstable_bytes;
+    }
 public:
     size_tiered_compaction_strategy_options(const std::map<sstring, sstring>& options);
 
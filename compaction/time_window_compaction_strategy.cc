@@ -274,8 +274,25 @@ time_window_compaction_strategy::get_next_non_expired_sstables(table_state& tabl
     if (non_expiring_sstables.empty()) {
         return {};
     }
-    auto it = boost::min_element(non_expiring_sstables, [] (auto& i, auto& j) {
-        return i->get_stats_metadata().min_timestamp < j->get_stats_metadata().min_timestamp;
+    // Restrict the choice to the oldest window, whose droppable data cannot
+    // shadow anything in an older sstable, and within it pick the sstable
+    // with the highest droppable tombstone ratio. For TTL'd time-series
+    // that is the mostly-expired sstable where a single rewrite reclaims
+    // the most space per byte of compaction I/O.
+    auto oldest_window = get_window_lower_bound(_options.sstable_window_size,
+        to_timestamp_type(_options.timestamp_resolution,
+            (*boost::min_element(non_expiring_sstables, [] (auto& i, auto& j) {
+                return i->get_stats_metadata().max_timestamp < j->get_stats_metadata().max_timestamp;
+            }))->get_stats_metadata().max_timestamp));
+    auto e2 = boost::range::remove_if(non_expiring_sstables, [this, oldest_window] (const shared_sstable& sst) -> bool {
+        auto ts = to_timestamp_type(_options.timestamp_resolution, sst->get_stats_metadata().max_timestamp);
+        return get_window_lower_bound(_options.sstable_window_size, ts) != oldest_window;
+    });
+    non_expiring_sstables.erase(e2, non_expiring_sstables.end());
+    auto it = std::max_element(non_expiring_sstables.begin(), non_expiring_sstables.end(), [compaction_time] (auto& i, auto& j) {
+        auto gc_before1 = i->get_gc_before_for_drop_estimation(compaction_time);
+        auto gc_before2 = j->get_gc_before_for_drop_estimation(compaction_time);
+        return i->estimate_droppable_tombstone_ratio(gc_before1) < j->estimate_droppable_tombstone_ratio(gc_before2);
     });
     return { *it };
 }
@@ -38,7 +38,7 @@ public:
         , _byte_order_equal(std::all_of(_types.begin(), _types.end(), [] (const auto& t) {
                 return t->is_byte_order_equal();
             }))
-        , _byte_order_comparable(false)
+        , _byte_order_comparable(is_byte_order_comparable(_types))
         , _is_reversed(_types.size() == 1 && _types[0]->is_reversed())
     { }
 
@@ -51,6 +51,29 @@ public:
     bool is_singular() const {
         return _types.size() == 1;
     }
+private:
+    // Decided once, when the schema's key types are built; compare() then
+    // picks the raw memcmp path over per-component dispatch for qualifying
+    // layouts. Each component is preceded by a length prefix which takes part
+    // in a raw byte comparison, so the serialized form only sorts like a
+    // plain byte string if every component is fixed-width: the prefixes then
+    // compare equal whenever both values are present, and an absent (empty)
+    // component still sorts first, like in the typed comparators. A prefix
+    // with fewer components is an exact byte prefix, so memcmp also orders
+    // prefixes correctly. Reversed components flip the direction per
+    // component; only the singular case is supported, via _is_reversed.
+    static bool is_byte_order_comparable(const std::vector<data_type>& types) {
+        auto fixed_width_and_comparable = [] (const data_type& t) {
+            return t->is_byte_order_comparable() && t->value_length_if_fixed().has_value();
+        };
+        if (types.size() == 1) {
+            return fixed_width_and_comparable(types[0]->underlying_type());
+        }
+        return std::all_of(types.begin(), types.end(), [&] (const data_type& t) {
+            return !t->is_reversed() && fixed_width_and_comparable(t);
+        });
+    }
+public:
 
     prefix_type as_prefix() {
         return prefix_type(_types);
@@ -209,11 +232,7 @@ public:
         return result;
     }
     bool less(managed_bytes_view b1, managed_bytes_view b2) const {
-        return with_linearized(b1, [&] (bytes_view bv1) {
-            return with_linearized(b2, [&] (bytes_view bv2) {
-                return less(bv1, bv2);
-            });
-        });
+        return compare(b1, b2) < 0;
     }
     bool less(bytes_view b1, bytes_view b2) const {
         return compare(b1, b2) < 0;
@@ -235,12 +254,19 @@ public:
         }
         return h;
     }
+    // Compares fragment-by-fragment, without linearizing multi-fragment keys.
     std::strong_ordering compare(managed_bytes_view b1, managed_bytes_view b2) const {
-        return with_linearized(b1, [&] (bytes_view bv1) {
-            return with_linearized(b2, [&] (bytes_view bv2) {
-                return compare(bv1, bv2);
+        if (_byte_order_comparable) {
+            if (_is_reversed) {
+                return compare_unsigned(b2, b1);
+            } else {
+                return compare_unsigned(b1, b2);
+            }
+        }
+        return lexicographical_tri_compare(_types.begin(), _types.end(),
+            begin(b1), end(b1), begin(b2), end(b2), [] (auto&& type, auto&& v1, auto&& v2) {
+                return type->compare(v1, v2);
             });
-        });
     }
     std::strong_ordering compare(bytes_view b1, bytes_view b2) const {
         if (_byte_order_comparable) {
@@ -284,11 +310,11 @@ public:
         }
     }
     bool equal(managed_bytes_view v1, managed_bytes_view v2) const {
-        return with_linearized(v1, [&] (bytes_view bv1) {
-            return with_linearized(v2, [&] (bytes_view bv2) {
-                return equal(bv1, bv2);
-            });
-        });
+        if (_byte_order_equal) {
+            return equal_unsigned(v1, v2);
+        }
+        // FIXME: call equal() on each component
+        return compare(v1, v2) == 0;
     }
     bool equal(bytes_view v1, bytes_view v2) const {
         if (_byte_order_equal) {
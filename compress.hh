@@ -10,11 +10,13 @@
 
 #include <map>
 #include <set>
+#include <vector>
 
 #include <seastar/core/future.hh>
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/core/sstring.hh>
 
+#include "bytes.hh"
 #include "exceptions/exceptions.hh"
 
 
@@ -42,6 +44,20 @@ public:
      */
     virtual size_t compress_max_size(size_t input_len) const = 0;
 
+    /**
+     * Supplies a pre-trained shared dictionary to be used by subsequent
+     * compress()/uncompress() calls. Compressors that do not support
+     * dictionaries ignore it.
+     */
+    virtual void set_dictionary(const bytes& dict) { (void)dict; }
+
+    /**
+     * Whether this compressor makes use of set_dictionary().
+     */
+    virtual bool supports_dictionary() const {
+        return false;
+    }
+
     /**
      * Returns accepted option names for this compressor
      */
@@ -73,6 +89,34 @@ public:
     static const sstring namespace_prefix;
 };
 
+/**
+ * Trains a zstd dictionary from sampled uncompressed chunks.
+ *
+ * Small rows compress poorly chunk-by-chunk because each chunk starts with an
+ * empty history; a dictionary trained on the table's data recovers most of
+ * the lost ratio. Samples are accumulated up to a byte budget (e.g. fed from
+ * the stream of chunks during compaction), then train() produces a dictionary
+ * suitable for compressor::set_dictionary().
+ */
+class zstd_dict_trainer {
+    std::vector<bytes> _samples;
+    size_t _sampled_bytes = 0;
+    size_t _max_samples_bytes;
+    size_t _max_dict_size;
+public:
+    explicit zstd_dict_trainer(size_t max_samples_bytes = 16 * 1024 * 1024, size_t max_dict_size = 64 * 1024);
+    /**
+     * Adds a sample. Returns false once the sample budget is exhausted and
+     * further samples would be ignored.
+     */
+    bool add_sample(bytes_view sample);
+    /**
+     * Trains a dictionary from the accumulated samples. Throws
+     * std::runtime_error if training fails (e.g. too few samples).
+     */
+    bytes train() const;
+};
+
 template<typename BaseType, typename... Args>
 class class_registry;
 
@@ -414,6 +414,7 @@ scylla_tests = set([
     'test/boost/hash_test',
     'test/boost/hashers_test',
     'test/boost/hint_test',
+    'test/boost/hot_partition_sketch_test',
     'test/boost/idl_test',
     'test/boost/input_stream_test',
     'test/boost/json_cql_query_test',
@@ -468,6 +469,7 @@ scylla_tests = set([
     'test/boost/sstable_datafile_test',
     'test/boost/sstable_mutation_test',
     'test/boost/sstable_partition_index_cache_test',
+    'test/boost/partition_trie_index_test',
     'test/boost/schema_changes_test',
     'test/boost/sstable_conforms_to_mutation_source_test',
     'test/boost/sstable_compaction_test',
@@ -715,6 +717,7 @@ scylla_core = (['replica/database.cc',
                 'sstables/sstables_manager.cc',
                 'sstables/sstable_set.cc',
                 'sstables/mx/partition_reversing_data_source.cc',
+                'sstables/mx/partition_trie_index.cc',
                 'sstables/mx/reader.cc',
                 'sstables/mx/writer.cc',
                 'sstables/kl/reader.cc',
@@ -1165,6 +1168,7 @@ deps = {
 
 pure_boost_tests = set([
     'test/boost/anchorless_list_test',
+    'test/boost/partition_trie_index_test',
     'test/boost/auth_passwords_test',
     'test/boost/auth_resource_test',
     'test/boost/big_decimal_test',
@@ -1256,6 +1260,7 @@ deps['test/boost/bytes_ostream_test'] = [
 ]
 deps['test/boost/input_stream_test'] = ['test/boost/input_stream_test.cc']
 deps['test/boost/UUID_test'] = ['utils/UUID_gen.cc', 'test/boost/UUID_test.cc', 'utils/uuid.cc', 'utils/dynamic_bitset.cc', 'hashers.cc']
+deps['test/boost/partition_trie_index_test'] = ['test/boost/partition_trie_index_test.cc', 'sstables/mx/partition_trie_index.cc']
 deps['test/boost/murmur_hash_test'] = ['bytes.cc', 'utils/murmur_hash.cc', 'test/boost/murmur_hash_test.cc']
 deps['test/boost/allocation_strategy_test'] = ['test/boost/allocation_strategy_test.cc', 'utils/logalloc.cc', 'utils/dynamic_bitset.cc']
 deps['test/boost/log_heap_test'] = ['test/boost/log_heap_test.cc']
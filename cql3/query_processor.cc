@@ -556,6 +556,33 @@ query_processor::prepare(sstring query_string, const service::client_state& clie
     }
 }
 
+void query_processor::maybe_propagate_prepared_to_other_shards(const prepared_cache_key_type& key, const sstring& query_string, sstring keyspace) noexcept {
+    if (smp::count == 1) {
+        return;
+    }
+    try {
+        (void)container().invoke_on_others([key, query_string, keyspace] (query_processor& qp) {
+            if (qp._prepared_cache.find(key)) {
+                return make_ready_future<>();
+            }
+            return qp._prepared_cache.get(key, [&qp, query_string, keyspace] {
+                auto statement = qp.parse_statement(query_string);
+                if (auto cf_stmt = dynamic_cast<raw::cf_statement*>(statement.get())) {
+                    cf_stmt->prepare_keyspace(std::string_view(keyspace));
+                }
+                ++qp._stats.prepare_invocations;
+                auto prepared = statement->prepare(qp._db, qp._cql_stats);
+                prepared->statement->raw_cql_statement = query_string;
+                return make_ready_future<std::unique_ptr<statements::prepared_statement>>(std::move(prepared));
+            }).discard_result();
+        }).handle_exception([] (std::exception_ptr ep) {
+            log.debug("Failed to propagate prepared statement to other shards: {}", ep);
+        });
+    } catch (...) {
+        // Propagation is an optimization; the local prepare already succeeded.
+    }
+}
+
 static std::string hash_target(std::string_view query_string, std::string_view keyspace) {
     std::string ret(keyspace);
     ret += query_string;
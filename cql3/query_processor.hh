@@ -417,6 +417,14 @@ private:
      */
     bool has_more_results(::shared_ptr<cql3::internal_query_state> state) const;
 
+    /*!
+     * \brief prepare the given statement on all other shards, in the background
+     *
+     * Best effort: failures are logged and otherwise ignored, since a shard
+     * which misses the statement will simply re-prepare it on first use.
+     */
+    void maybe_propagate_prepared_to_other_shards(const prepared_cache_key_type& key, const sstring& query_string, sstring keyspace) noexcept;
+
     ///
     /// \tparam ResultMsgType type of the returned result message (CQL or Thrift)
     /// \tparam PreparedKeyGenerator a function that generates the prepared statement cache key for given query and
@@ -440,7 +448,7 @@ private:
                 id_gen(query_string, client_state.get_raw_keyspace()),
                 std::move(query_string),
                 [this, &client_state, &id_getter](const prepared_cache_key_type& key, const sstring& query_string) {
-            return _prepared_cache.get(key, [this, &query_string, &client_state] {
+            return _prepared_cache.get(key, [this, &key, &query_string, &client_state] {
                 auto prepared = get_statement(query_string, client_state);
                 auto bound_terms = prepared->statement->get_bound_terms();
                 if (bound_terms > std::numeric_limits<uint16_t>::max()) {
@@ -450,6 +458,11 @@ private:
                                    std::numeric_limits<uint16_t>::max()));
                 }
                 assert(bound_terms == prepared->bound_names.size());
+                // This shard had to prepare from scratch, so the other shards
+                // most likely miss the statement too. Warm their caches up in
+                // the background so that the client's next request doesn't hit
+                // an "unprepared" response when it lands on a different shard.
+                maybe_propagate_prepared_to_other_shards(key, query_string, client_state.get_raw_keyspace());
                 return make_ready_future<std::unique_ptr<statements::prepared_statement>>(std::move(prepared));
             }).then([&key, &id_getter, &client_state] (auto prep_ptr) {
                 const auto& warnings = prep_ptr->warnings;
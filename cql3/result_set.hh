@@ -44,6 +44,12 @@ public:
     // (CASSANDRA-4911). So the serialization code will exclude any columns in name whose index is >= columnCount.
         std::vector<lw_shared_ptr<column_specification>> _names;
         uint32_t _column_count;
+        // Wire-format encoding of the serialized column specifications,
+        // filled in by the CQL transport the first time they go out on the
+        // wire. The column_info object is shared between all result sets of
+        // a statement, so for prepared statements this is encoded once per
+        // shard rather than once per response.
+        std::optional<bytes> _wire_specs;
 
         column_info(std::vector<lw_shared_ptr<column_specification>> names, uint32_t column_count)
             : _names(std::move(names))
@@ -91,6 +97,20 @@ public:
     const std::vector<lw_shared_ptr<column_specification>>& get_names() const {
         return _column_info->_names;
     }
+
+    // The cached wire-format column specifications, if they were already
+    // encoded once. The specs are fixed when the statement is prepared and
+    // their encoding does not depend on the protocol version, so responses
+    // can splice the same blob. Callable on const objects since the cache
+    // lives in the shared column_info, not in this (possibly per-response)
+    // metadata instance.
+    const std::optional<bytes>& cached_wire_specs() const {
+        return _column_info->_wire_specs;
+    }
+
+    void set_cached_wire_specs(bytes specs) const {
+        _column_info->_wire_specs = std::move(specs);
+    }
 };
 
 ::shared_ptr<const cql3::metadata> make_empty_metadata();
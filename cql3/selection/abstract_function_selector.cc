@@ -77,6 +77,21 @@ abstract_function_selector::new_factory(shared_ptr<functions::function> fun, sha
             }
             return p->name().name == "countRows";
         }
+
+        virtual std::optional<std::pair<uint32_t, bool>> single_column_minmax_factory() const override {
+            if (!_fun->is_native() || !_fun->is_aggregate()) {
+                return std::nullopt;
+            }
+            const auto& name = _fun->name().name;
+            if (name != "min" && name != "max") {
+                return std::nullopt;
+            }
+            auto arg_idx = _factories->sole_simple_selection_index();
+            if (!arg_idx) {
+                return std::nullopt;
+            }
+            return std::make_pair(*arg_idx, name == "max");
+        }
     };
 
     return make_shared<fun_selector_factory>(std::move(fun), std::move(factories));
@@ -182,6 +182,14 @@ public:
         return _factories->does_count();
     }
 
+    virtual std::optional<std::pair<const column_definition*, bool>> sole_column_minmax_aggregate() const override {
+        auto minmax = _factories->single_column_minmax();
+        if (!minmax) {
+            return std::nullopt;
+        }
+        return std::make_pair(get_columns()[minmax->first], minmax->second);
+    }
+
 protected:
     class selectors_with_processing : public selectors {
     private:
@@ -404,6 +412,8 @@ result_set_builder::restrictions_filter::restrictions_filter(::shared_ptr<restri
     , _options(options)
     , _skip_pk_restrictions(!_restrictions->pk_restrictions_need_filtering())
     , _skip_ck_restrictions(!_restrictions->ck_restrictions_need_filtering())
+    , _multi_column_clustering_restrictions(bool(dynamic_pointer_cast<cql3::restrictions::multi_column_restriction>(
+            _restrictions->get_clustering_columns_restrictions())))
     , _remaining(remaining)
     , _schema(schema)
     , _per_partition_limit(per_partition_limit)
@@ -423,13 +433,10 @@ bool result_set_builder::restrictions_filter::do_filter(const selection& selecti
         return false;
     }
 
-    auto clustering_columns_restrictions = _restrictions->get_clustering_columns_restrictions();
-    if (dynamic_pointer_cast<cql3::restrictions::multi_column_restriction>(clustering_columns_restrictions)) {
-        clustering_key_prefix ckey = clustering_key_prefix::from_exploded(clustering_key);
-        // FIXME: push to upper layer so it happens once per row
+    if (_multi_column_clustering_restrictions) {
         auto static_and_regular_columns = expr::get_non_pk_values(selection, static_row, row);
         return expr::is_satisfied_by(
-                clustering_columns_restrictions->expression,
+                _restrictions->get_clustering_columns_restrictions()->expression,
                 expr::evaluation_inputs{
                     .partition_key = &partition_key,
                     .clustering_key = &clustering_key,
@@ -441,7 +448,10 @@ bool result_set_builder::restrictions_filter::do_filter(const selection& selecti
 
     auto static_row_iterator = static_row.iterator();
     auto row_iterator = row ? std::optional<query::result_row_view::iterator_type>(row->iterator()) : std::nullopt;
-    auto non_pk_restrictions_map = _restrictions->get_non_pk_restriction();
+    const auto& non_pk_restrictions_map = _restrictions->get_non_pk_restriction();
+    // Materialized lazily, at most once per row, only if some non-primary-key
+    // restriction needs it.
+    std::optional<std::vector<managed_bytes_opt>> static_and_regular_columns;
     for (auto&& cdef : selection.get_columns()) {
         switch (cdef->kind) {
         case column_kind::static_column:
@@ -455,14 +465,15 @@ bool result_set_builder::restrictions_filter::do_filter(const selection& selecti
                 continue;
             }
             restrictions::single_column_restriction& restriction = *restr_it->second;
-            // FIXME: push to upper layer so it happens once per row
-            auto static_and_regular_columns = expr::get_non_pk_values(selection, static_row, row);
+            if (!static_and_regular_columns) {
+                static_and_regular_columns.emplace(expr::get_non_pk_values(selection, static_row, row));
+            }
             bool regular_restriction_matches = expr::is_satisfied_by(
                     restriction.expression,
                     expr::evaluation_inputs{
                         .partition_key = &partition_key,
                         .clustering_key = &clustering_key,
-                        .static_and_regular_columns = &static_and_regular_columns,
+                        .static_and_regular_columns = &*static_and_regular_columns,
                         .selection = &selection,
                         .options = &_options,
                     });
@@ -476,7 +487,7 @@ bool result_set_builder::restrictions_filter::do_filter(const selection& selecti
             if (_skip_pk_restrictions) {
                 continue;
             }
-            auto partition_key_restrictions_map = _restrictions->get_single_column_partition_key_restrictions();
+            const auto& partition_key_restrictions_map = _restrictions->get_single_column_partition_key_restrictions();
             auto restr_it = partition_key_restrictions_map.find(cdef);
             if (restr_it == partition_key_restrictions_map.end()) {
                 continue;
@@ -500,7 +511,7 @@ bool result_set_builder::restrictions_filter::do_filter(const selection& selecti
             if (_skip_ck_restrictions) {
                 continue;
             }
-            auto clustering_key_restrictions_map = _restrictions->get_single_column_clustering_key_restrictions();
+            const auto& clustering_key_restrictions_map = _restrictions->get_single_column_clustering_key_restrictions();
             auto restr_it = clustering_key_restrictions_map.find(cdef);
             if (restr_it == clustering_key_restrictions_map.end()) {
                 continue;
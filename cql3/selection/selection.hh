@@ -144,6 +144,15 @@ public:
 
     virtual bool is_count() const {return false;}
 
+    /**
+     * If the selection consists of a single min() or max() aggregate applied
+     * directly to a column, returns the aggregated column and whether the
+     * aggregate is max() (as opposed to min()).
+     */
+    virtual std::optional<std::pair<const column_definition*, bool>> sole_column_minmax_aggregate() const {
+        return std::nullopt;
+    }
+
     /**
      * Checks that selectors are either all aggregates or that none of them is.
      *
@@ -215,6 +224,9 @@ public:
         const query_options& _options;
         const bool _skip_pk_restrictions;
         const bool _skip_ck_restrictions;
+        // Restriction shape is fixed at prepare time, so resolve it once here
+        // instead of inspecting the restriction tree for every row.
+        const bool _multi_column_clustering_restrictions;
         mutable bool _current_partition_key_does_not_match = false;
         mutable bool _current_static_row_does_not_match = false;
         mutable uint64_t _rows_dropped = 0;
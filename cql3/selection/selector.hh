@@ -130,6 +130,23 @@ public:
         return false;
     }
 
+    /**
+     * If this factory creates selectors computing a min() or max() aggregate
+     * directly over a single selected column, returns the index of that column
+     * in the selection and whether the aggregate is max() (as opposed to min()).
+     */
+    virtual std::optional<std::pair<uint32_t, bool>> single_column_minmax_factory() const {
+        return std::nullopt;
+    }
+
+    /**
+     * If this factory creates selectors returning a single column unmodified,
+     * returns the index of that column in the selection.
+     */
+    virtual std::optional<uint32_t> simple_selection_index() const {
+        return std::nullopt;
+    }
+
     /**
      * Checks if this factory creates <code>writetime</code> selectors instances.
      *
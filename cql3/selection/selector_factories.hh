@@ -105,6 +105,30 @@ public:
         return _factories[0]->is_count_selector_factory();
     }
 
+    /**
+     * If these factories consist of a single factory creating min() or max()
+     * selectors over a directly selected column, returns the index of that
+     * column in the selection and whether the aggregate is max() (as opposed
+     * to min()).
+     */
+    std::optional<std::pair<uint32_t, bool>> single_column_minmax() const {
+        if (_factories.size() != 1) {
+            return std::nullopt;
+        }
+        return _factories[0]->single_column_minmax_factory();
+    }
+
+    /**
+     * If these factories consist of a single factory selecting a column
+     * directly, returns the index of that column in the selection.
+     */
+    std::optional<uint32_t> sole_simple_selection_index() const {
+        if (_factories.size() != 1) {
+            return std::nullopt;
+        }
+        return _factories[0]->simple_selection_index();
+    }
+
     /**
      * Checks if this <code>SelectorFactories</code> contains at least one factory for writetime selectors.
      *
@@ -37,6 +37,10 @@ public:
         return _type;
     }
 
+    virtual std::optional<uint32_t> simple_selection_index() const override {
+        return _idx;
+    }
+
     virtual ::shared_ptr<selector> new_instance() const override;
 };
 
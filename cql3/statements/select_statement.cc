@@ -175,10 +175,54 @@ select_statement::select_statement(schema_ptr schema,
     , _ks_sel(::is_internal_keyspace(schema->ks_name()) ? ks_selector::SYSTEM : ks_selector::NONSYSTEM)
     , _attrs(std::move(attrs))
 {
+    // SELECT min(ck)/max(ck): the answer is determined by the row at one end
+    // of each partition (within the restricted clustering ranges), so read
+    // towards that end and let each partition contribute a single row instead
+    // of streaming whole partitions through the aggregation.
+    if (auto minmax = _selection->sole_column_minmax_aggregate();
+            minmax
+            && minmax->first->is_clustering_key()
+            && minmax->first->component_index() == 0
+            && !_restrictions_need_filtering
+            && !_restrictions->uses_secondary_indexing()
+            && _group_by_cell_indices->empty()
+            && !_parameters->is_distinct()) {
+        const auto& [col, is_max] = *minmax;
+        // min()/max() over compound types compare with the column's own type,
+        // which for a DESC-ordered column is the reversed one, so the row they
+        // select is not at the end the clustering order predicts. Leave those
+        // to the generic path.
+        const auto underlying = col->type->underlying_type();
+        const bool inverted_comparator = col->type->is_reversed()
+                && (underlying->is_collection() || underlying->is_tuple() || underlying->is_user_type());
+        if (!inverted_comparator) {
+            _minmax_of_first_clustering = true;
+            // The sought row is the clustering-largest one for max() on an ASC
+            // column and for min() on a DESC one. ORDER BY is irrelevant for
+            // the single-row aggregate result, so overriding it is safe.
+            _is_reversed = is_max != col->type->is_reversed();
+        }
+    }
     _opts = _selection->get_query_options();
     _opts.set_if<query::partition_slice::option::bypass_cache>(_parameters->bypass_cache());
     _opts.set_if<query::partition_slice::option::distinct>(_parameters->is_distinct());
     _opts.set_if<query::partition_slice::option::reversed>(_is_reversed);
+
+    if (_selection->contains_static_columns()) {
+        _static_columns_mask.reserve(_selection->get_column_count());
+    }
+    _regular_columns_mask.reserve(_selection->get_column_count());
+    for (auto&& col : _selection->get_columns()) {
+        if (col->is_static()) {
+            _static_columns_mask.push_back(col->id);
+        } else if (col->is_regular()) {
+            _regular_columns_mask.push_back(col->id);
+        }
+    }
+
+    if (!expr::contains_bind_marker(_restrictions->get_clustering_columns_restrictions()->expression)) {
+        _prepared_bounds = _restrictions->get_clustering_bounds(query_options::DEFAULT);
+    }
 }
 
 db::timeout_clock::duration select_statement::get_timeout(const service::client_state& state, const query_options& options) const {
@@ -225,29 +269,15 @@ const sstring& select_statement::column_family() const {
 query::partition_slice
 select_statement::make_partition_slice(const query_options& options) const
 {
-    query::column_id_vector static_columns;
-    query::column_id_vector regular_columns;
-
-    if (_selection->contains_static_columns()) {
-        static_columns.reserve(_selection->get_column_count());
-    }
-
-    regular_columns.reserve(_selection->get_column_count());
-
-    for (auto&& col : _selection->get_columns()) {
-        if (col->is_static()) {
-            static_columns.push_back(col->id);
-        } else if (col->is_regular()) {
-            regular_columns.push_back(col->id);
-        }
-    }
+    query::column_id_vector static_columns = _static_columns_mask;
+    query::column_id_vector regular_columns = _regular_columns_mask;
 
     if (_parameters->is_distinct()) {
         return query::partition_slice({ query::clustering_range::make_open_ended_both_sides() },
             std::move(static_columns), {}, _opts, nullptr, options.get_cql_serialization_format());
     }
 
-    auto bounds =_restrictions->get_clustering_bounds(options);
+    auto bounds = _prepared_bounds ? *_prepared_bounds : _restrictions->get_clustering_bounds(options);
     if (bounds.size() > 1) {
         auto comparer = position_in_partition::less_compare(*_schema);
         auto bounds_sorter = [&comparer] (const query::clustering_range& lhs, const query::clustering_range& rhs) {
@@ -260,7 +290,8 @@ select_statement::make_partition_slice(const query_options& options) const
         ++_stats.reverse_queries;
     }
     return query::partition_slice(std::move(bounds),
-        std::move(static_columns), std::move(regular_columns), _opts, nullptr, options.get_cql_serialization_format(), get_per_partition_limit(options));
+        std::move(static_columns), std::move(regular_columns), _opts, nullptr, options.get_cql_serialization_format(),
+        _minmax_of_first_clustering ? 1 : get_per_partition_limit(options));
 }
 
 uint64_t select_statement::do_get_limit(const query_options& options,
@@ -680,18 +711,36 @@ indexed_table_select_statement::do_execute_base_query(
             }
             next_iteration_size = std::min<size_t>({next_iteration_size, keys.size() - already_done, max_base_table_query_concurrency});
             auto key_it_end = key_it + next_iteration_size;
-            auto command = ::make_lw_shared<query::read_command>(*cmd);
+
+            // Index entries are sorted, so all rows of one base partition are
+            // adjacent in the key vector. Batch them into a single command
+            // with one clustering range per matching row, so that a partition
+            // with many matching rows costs one round-trip instead of one
+            // per row.
+            struct partition_batch {
+                std::vector<primary_key>::iterator begin;
+                std::vector<primary_key>::iterator end;
+            };
+            std::vector<partition_batch> batches;
+            for (auto it = key_it; it != key_it_end;) {
+                auto batch_end = it + 1;
+                while (batch_end != key_it_end && batch_end->partition.equal(*_schema, it->partition)) {
+                    ++batch_end;
+                }
+                batches.push_back(partition_batch{it, batch_end});
+                it = batch_end;
+            }
 
             query::result_merger oneshot_merger(cmd->get_row_limit(), query::max_partitions);
-            return utils::result_map_reduce(key_it, key_it_end, [this, &qp, &state, &options, cmd, timeout] (auto& key) {
+            return utils::result_map_reduce(batches.begin(), batches.end(), [this, &qp, &state, &options, cmd, timeout] (const partition_batch& batch) {
                 auto command = ::make_lw_shared<query::read_command>(*cmd);
-                // for each partition, read just one clustering row (TODO: can
-                // get all needed rows of one partition at once.)
                 command->slice._row_ranges.clear();
-                if (key.clustering) {
-                    command->slice._row_ranges.push_back(query::clustering_range::make_singular(key.clustering));
+                for (auto it = batch.begin; it != batch.end; ++it) {
+                    if (it->clustering) {
+                        command->slice._row_ranges.push_back(query::clustering_range::make_singular(it->clustering));
+                    }
                 }
-                return qp.proxy().query_result(_schema, command, {dht::partition_range::make_singular(key.partition)}, options.get_consistency(), {timeout, state.get_permit(), state.get_client_state(), state.get_trace_state()})
+                return qp.proxy().query_result(_schema, command, {dht::partition_range::make_singular(batch.begin->partition)}, options.get_consistency(), {timeout, state.get_permit(), state.get_client_state(), state.get_trace_state()})
                 .then(utils::result_wrap([] (service::storage_proxy::coordinator_query_result qr) -> coordinator_result<foreign_ptr<lw_shared_ptr<query::result>>> {
                     return std::move(qr.query_result);
                 }));
@@ -74,10 +74,24 @@ protected:
     ordering_comparator_type _ordering_comparator;
 
     query::partition_slice::option_set _opts;
+    /// Column masks for the partition slice. They depend only on the
+    /// selection, so they are computed once at prepare time and copied
+    /// into each execution's slice.
+    query::column_id_vector _static_columns_mask;
+    query::column_id_vector _regular_columns_mask;
+    /// Clustering bounds cached at prepare time when the clustering
+    /// restrictions contain no bind markers, so executions don't have to
+    /// re-evaluate the restriction expressions. Single-partition point
+    /// reads with a bound partition key fall in this category.
+    std::optional<std::vector<query::clustering_range>> _prepared_bounds;
     cql_stats& _stats;
     const ks_selector _ks_sel;
     bool _range_scan = false;
     bool _range_scan_no_bypass_cache = false;
+    /// Whether the query is a sole min()/max() over the first clustering
+    /// column, answerable by reading one row per partition from the right
+    /// end. See the fast path in the constructor.
+    bool _minmax_of_first_clustering = false;
     std::unique_ptr<cql3::attributes> _attrs;
 protected :
     virtual future<::shared_ptr<cql_transport::messages::result_message>> do_execute(query_processor& qp,
@@ -122,6 +122,9 @@ cql3::untyped_result_set::untyped_result_set(const schema& s, foreign_ptr<lw_sha
     auto& metadata = *std::get<1>(qt);
 
     _index = make_index(metadata);
+    if (auto rc = qres->row_count()) {
+        _rows.reserve(*rc);
+    }
     visitor v{_rows, metadata, *_index};
     result_generator::query_result_visitor<visitor> vv(s, v, selection);
     query::result_view::consume(*qres, slice, vv);
@@ -63,6 +63,7 @@ public:
         uint64_t reads;
         uint64_t reads_with_misses;
         uint64_t reads_done;
+        uint64_t pinned_rows;
         uint64_t pinned_dirty_memory_overload;
         uint64_t range_tombstone_reads;
         uint64_t row_tombstone_reads;
@@ -76,6 +77,11 @@ private:
     seastar::metrics::metric_groups _metrics;
     logalloc::region _region;
     lru _lru;
+    // Entries pinned with pin(). Not visited by the memory reclaimer, drained
+    // only by clear(). Pinned entries still live on the same LSA region; the
+    // separate list only makes them invisible to eviction.
+    lru _pinned_lru;
+    uint64_t _pinned_row_limit = default_pinned_row_limit;
     mutation_cleaner _garbage;
     mutation_cleaner _memtable_cleaner;
     mutation_application_stats& _app_stats;
@@ -83,6 +89,8 @@ private:
     void setup_metrics();
 public:
     using register_metrics = bool_class<class register_metrics_tag>;
+    // Keeps pinning bounded so that eviction always has something to reclaim.
+    static constexpr uint64_t default_pinned_row_limit = 100'000;
     cache_tracker(mutation_application_stats&, register_metrics);
     cache_tracker(register_metrics = register_metrics::no);
     ~cache_tracker();
@@ -92,7 +100,13 @@ public:
     void insert(partition_entry&) noexcept;
     void insert(partition_version&) noexcept;
     void insert(rows_entry&) noexcept;
-    void on_remove() noexcept;
+    void on_remove(rows_entry&) noexcept;
+    bool can_pin(uint64_t rows) const noexcept;
+    void pin(rows_entry&) noexcept;
+    void unpin(rows_entry&) noexcept;
+    void on_row_unpinned() noexcept;
+    void set_pinned_row_limit(uint64_t limit) noexcept { _pinned_row_limit = limit; }
+    uint64_t pinned_rows() const noexcept { return _stats.pinned_rows; }
     void clear_continuity(cache_entry& ce) noexcept;
     void on_partition_erase() noexcept;
     void on_partition_merge() noexcept;
@@ -123,9 +137,38 @@ public:
 };
 
 inline
-void cache_tracker::on_remove() noexcept {
+void cache_tracker::on_remove(rows_entry& entry) noexcept {
     --_stats.rows;
     ++_stats.row_removals;
+    if (entry.pinned()) {
+        on_row_unpinned();
+    }
+}
+
+inline
+void cache_tracker::on_row_unpinned() noexcept {
+    --_stats.pinned_rows;
+}
+
+inline
+bool cache_tracker::can_pin(uint64_t rows) const noexcept {
+    return _stats.pinned_rows + rows <= _pinned_row_limit;
+}
+
+inline
+void cache_tracker::pin(rows_entry& entry) noexcept {
+    entry.set_pinned(true);
+    entry.unlink_from_lru();
+    _pinned_lru.add(entry);
+    ++_stats.pinned_rows;
+}
+
+inline
+void cache_tracker::unpin(rows_entry& entry) noexcept {
+    entry.set_pinned(false);
+    entry.unlink_from_lru();
+    _lru.add(entry);
+    on_row_unpinned();
 }
 
 inline
@@ -57,6 +57,8 @@
 #include <boost/range/numeric.hpp>
 #include <boost/range/adaptor/transformed.hpp>
 
+#include <lz4.h>
+
 #include "checked-file-impl.hh"
 #include "utils/disk-error-handler.hh"
 
@@ -108,6 +110,7 @@ db::commitlog::config db::commitlog::config::from_db_config(const db::config& cf
     c.extensions = &cfg.extensions();
     c.use_o_dsync = cfg.commitlog_use_o_dsync();
     c.allow_going_over_size_limit = !cfg.commitlog_use_hard_size_limit();
+    c.use_compression = cfg.commitlog_use_compression();
 
     if (cfg.commitlog_flush_threshold_in_mb() >= 0) {
         c.commitlog_flush_threshold_in_mb = cfg.commitlog_flush_threshold_in_mb();
@@ -673,6 +676,12 @@ public:
     static constexpr size_t entry_overhead_size = 3 * sizeof(uint32_t);
     static constexpr size_t multi_entry_overhead_size = entry_overhead_size + sizeof(uint32_t);
     static constexpr size_t segment_overhead_size = 2 * sizeof(uint32_t);
+    // The compression sub-header of a version 3 chunk
+    // (int: uncompressed size + int: compressed size (0 = stored raw) + int: crc of both)
+    static constexpr size_t compressed_chunk_overhead_size = 3 * sizeof(uint32_t);
+    // Batches bigger than this are stored raw, to bound the contiguous
+    // allocations made by the block compressor on both ends.
+    static constexpr size_t max_compressible_chunk_size = 4 * 1024 * 1024;
     static constexpr size_t descriptor_header_size = 5 * sizeof(uint32_t);
     static constexpr uint32_t segment_magic = ('S'<<24) |('C'<< 16) | ('L' << 8) | 'C';
     static constexpr uint32_t multi_entry_size_magic = 0xffffffff;
@@ -869,10 +878,17 @@ public:
     /**
      * Allocate a new buffer
      */
+    // Per-chunk overhead in the logical layout. Version 3 chunks reserve
+    // extra room for the compression sub-header.
+    size_t chunk_overhead() const {
+        return segment_overhead_size
+                + (_desc.ver >= descriptor::segment_version_3 ? compressed_chunk_overhead_size : 0);
+    }
+
     void new_buffer(size_t s) {
         assert(_buffer.empty());
 
-        auto overhead = segment_overhead_size;
+        auto overhead = chunk_overhead();
         if (_file_pos == 0) {
             overhead += descriptor_header_size;
         }
@@ -888,9 +904,83 @@ public:
     }
 
     bool buffer_is_empty() const {
-        return buffer_position() <= segment_overhead_size
-                        || (_file_pos == 0 && buffer_position() <= (segment_overhead_size + descriptor_header_size));
+        return buffer_position() <= chunk_overhead()
+                        || (_file_pos == 0 && buffer_position() <= (chunk_overhead() + descriptor_header_size));
     }
+    /**
+     * Compresses the entry region of a cycle buffer (version 3 segments).
+     *
+     * The chunk keeps its logical extent in the segment - replay positions
+     * and the next-chunk pointer are unaffected - but only the physical
+     * prefix holding the headers and the (compressed) payload is written to
+     * disk; the remainder of the chunk is left as a hole in the preallocated
+     * segment file. The compression sub-header records the payload sizes so
+     * the reader can restore the original entry stream. Batches which do not
+     * shrink, or are too large to compress in one piece, are stored raw.
+     *
+     * Returns the buffer to write and its physical size.
+     */
+    std::pair<fragmented_temporary_buffer, size_t> compress_buffer(fragmented_temporary_buffer buf, size_t size, size_t header_size) {
+        auto entries_off = header_size + chunk_overhead();
+        auto entries_len = size - entries_off;
+
+        // Linearize the entry region for the block compressor.
+        auto src = std::make_unique<char[]>(entries_len);
+        auto v = fragmented_temporary_buffer::view(buf);
+        v.remove_suffix(buf.size_bytes() - size);
+        v.remove_prefix(entries_off);
+        size_t off = 0;
+        for (auto&& frag : v) {
+            std::copy_n(reinterpret_cast<const char*>(frag.data()), frag.size(), src.get() + off);
+            off += frag.size();
+        }
+
+        uint32_t compressed_size = 0;
+        std::unique_ptr<char[]> dst;
+        if (entries_len <= max_compressible_chunk_size) {
+            auto bound = LZ4_compressBound(entries_len);
+            dst = std::make_unique<char[]>(bound);
+            auto n = LZ4_compress_default(src.get(), dst.get(), entries_len, bound);
+            if (n > 0 && size_t(n) < entries_len) {
+                compressed_size = n;
+            }
+        }
+
+        const char* payload = compressed_size ? dst.get() : src.get();
+        size_t payload_len = compressed_size ? compressed_size : entries_len;
+
+        auto phys_size = align_up(entries_off + payload_len, _alignment);
+        if (phys_size >= size) {
+            // No gain. Store raw; the physical and logical layouts coincide.
+            compressed_size = 0;
+            payload = src.get();
+            payload_len = entries_len;
+            phys_size = size;
+        }
+
+        auto wbuf = _segment_manager->acquire_buffer(phys_size, _alignment);
+        _segment_manager->totals.buffer_list_bytes += wbuf.size_bytes();
+        _segment_manager->totals.buffer_list_bytes -= buf.size_bytes();
+
+        auto out = wbuf.get_ostream();
+        // Copy the already-written headers verbatim.
+        auto hv = fragmented_temporary_buffer::view(buf);
+        hv.remove_suffix(buf.size_bytes() - (entries_off - compressed_chunk_overhead_size));
+        for (auto&& frag : hv) {
+            out.write(reinterpret_cast<const char*>(frag.data()), frag.size());
+        }
+        crc32_nbo crc;
+        crc.process(uint32_t(entries_len));
+        crc.process(compressed_size);
+        write(out, uint32_t(entries_len));
+        write(out, compressed_size);
+        write(out, crc.checksum());
+        out.write(payload, payload_len);
+        out.fill('\0', phys_size - entries_off - payload_len);
+
+        return {std::move(wbuf), phys_size};
+    }
+
     /**
      * Send any buffer contents to disk and get a new tmp buffer
      */
@@ -954,14 +1044,19 @@ public:
             write(out, uint64_t(0));
         }
 
+        auto write_size = size;
+        if (!termination && _desc.ver >= descriptor::segment_version_3) {
+            std::tie(buf, write_size) = compress_buffer(std::move(buf), size, header_size);
+        }
+
         replay_position rp(_desc.id, position_type(off));
 
         // The write will be allowed to start now, but flush (below) must wait for not only this,
         // but all previous write/flush pairs.
         co_await _pending_ops.run_with_ordered_post_op(rp, [&]() -> future<> {
             auto view = fragmented_temporary_buffer::view(buf);
-            view.remove_suffix(buf.size_bytes() - size);
-            assert(size == view.size_bytes());
+            view.remove_suffix(buf.size_bytes() - write_size);
+            assert(write_size == view.size_bytes());
 
             if (view.empty()) {
                 co_return;
@@ -985,7 +1080,12 @@ public:
                     _segment_manager->totals.active_size_on_disk += bytes;
                     ++_segment_manager->totals.cycle_count;
                     if (bytes == view.size_bytes()) {
-                        clogger.trace("Final write of {} to {}: {}/{} bytes at {}", bytes, *this, size, size, off);
+                        clogger.trace("Final write of {} to {}: {}/{} bytes at {}", bytes, *this, write_size, write_size, off);
+                        // The hole between the physical end of a compressed
+                        // chunk and its logical end still counts towards the
+                        // segment's (logical) active size, since releasing a
+                        // segment gives back its logical file position.
+                        _segment_manager->totals.active_size_on_disk += size - write_size;
                         break;
                     }
                     // gah, partial write. should always get here with dma chunk sized
@@ -993,7 +1093,7 @@ public:
                     bytes = align_down(bytes, _alignment);
                     off += bytes;
                     view.remove_prefix(bytes);
-                    clogger.trace("Partial write of {} to {}: {}/{} bytes at at {}", bytes, *this, size - view.size_bytes(), size, off - bytes);
+                    clogger.trace("Partial write of {} to {}: {}/{} bytes at at {}", bytes, *this, write_size - view.size_bytes(), write_size, off - bytes);
                     continue;
                     // TODO: retry/ignore/fail/stop - optional behaviour in origin.
                     // we fast-fail the whole commit.
@@ -1662,7 +1762,8 @@ future<db::commitlog::segment_manager::sseg_ptr> db::commitlog::segment_manager:
 
 future<db::commitlog::segment_manager::sseg_ptr> db::commitlog::segment_manager::allocate_segment() {
     for (;;) {
-        descriptor d(next_id(), cfg.fname_prefix);
+        descriptor d(next_id(), cfg.fname_prefix,
+                cfg.use_compression ? descriptor::segment_version_3 : descriptor::segment_version_2);
         auto dst = filename(d);
         auto flags = open_flags::wo;
         if (cfg.use_o_dsync) {
@@ -2410,11 +2511,26 @@ db::commitlog::read_log_file(sstring filename, sstring pfx, seastar::io_priority
             return fo;
         }
     public:
+        // Serves the decompressed entries of one version 3 chunk.
+        class chunk_data_source final : public data_source_impl {
+            temporary_buffer<char> _buf;
+        public:
+            explicit chunk_data_source(temporary_buffer<char> buf)
+                : _buf(std::move(buf))
+            {}
+            future<temporary_buffer<char>> get() override {
+                return make_ready_future<temporary_buffer<char>>(std::exchange(_buf, {}));
+            }
+        };
+
         file f;
         descriptor d;
         commit_load_reader_func func;
         input_stream<char> fin;
         input_stream<char> r;
+        // When set, entries are parsed from here (the decompressed chunk)
+        // instead of the file stream.
+        std::optional<input_stream<char>> chunk_in;
         uint64_t id = 0;
         size_t pos = 0;
         size_t next = 0;
@@ -2444,12 +2560,22 @@ db::commitlog::read_log_file(sstring filename, sstring pfx, seastar::io_priority
         bool end_of_chunk() const {
             return eof || next == pos;
         }
+        // The stream entries are parsed from. Identical to the file stream
+        // except within a compressed chunk.
+        input_stream<char>& entry_stream() {
+            return chunk_in ? *chunk_in : fin;
+        }
         future<> skip(size_t bytes) {
             pos += bytes;
             if (pos > file_size) {
                 eof = true;
                 pos = file_size;
             }
+            if (chunk_in) {
+                // Skipping inside a decompressed chunk. The file stream is
+                // already positioned at the next chunk.
+                return chunk_in->skip(bytes);
+            }
             return fin.skip(bytes);
         }
         void stop() {
@@ -2538,11 +2664,95 @@ db::commitlog::read_log_file(sstring filename, sstring pfx, seastar::io_priority
                 co_return co_await skip(next - pos);
             }
 
+            if (d.ver >= descriptor::segment_version_3) {
+                co_return co_await read_compressed_chunk(start);
+            }
+
             while (!end_of_chunk()) {
                 co_await read_entry();
             }
         }
 
+        // Version 3 chunks carry a sub-header with payload sizes; the
+        // payload may be LZ4-compressed and then occupies only a physical
+        // prefix of the chunk's logical extent, the rest being a hole.
+        future<> read_compressed_chunk(uint32_t start) {
+            fragmented_temporary_buffer buf = co_await frag_reader.read_exactly(fin, segment::compressed_chunk_overhead_size);
+
+            if (!advance(buf)) {
+                co_return;
+            }
+
+            auto in = buf.get_istream();
+            auto uncompressed_size = read<uint32_t>(in);
+            auto compressed_size = read<uint32_t>(in);
+            auto checksum = read<uint32_t>(in);
+
+            crc32_nbo crc;
+            crc.process(uncompressed_size);
+            crc.process(compressed_size);
+
+            if (crc.checksum() != checksum || uncompressed_size != next - pos || compressed_size > uncompressed_size) {
+                // The next pointer was already verified, so only this chunk is lost.
+                clogger.debug("Compression sub-header of chunk at {} is broken. Skipping chunk ({} bytes)", start, next - pos);
+                corrupt_size += next - pos;
+                co_await skip(next - pos);
+                co_return;
+            }
+
+            if (compressed_size == 0) {
+                // Stored raw. The physical and logical layouts coincide, so
+                // entries can be read directly off the file stream.
+                while (!end_of_chunk()) {
+                    co_await read_entry();
+                }
+                co_return;
+            }
+
+            // Physical reads below do not advance the logical position;
+            // parsing the decompressed entries does.
+            fragmented_temporary_buffer payload = co_await frag_reader.read_exactly(fin, compressed_size);
+            if (payload.size_bytes() < compressed_size) {
+                eof = true;
+                co_return;
+            }
+
+            // The rest of the chunk is a hole. Position the file stream at
+            // the next chunk right away.
+            auto phys_end = start + segment::segment_overhead_size + segment::compressed_chunk_overhead_size + compressed_size;
+            co_await fin.skip(next - phys_end);
+
+            auto src = std::make_unique<char[]>(compressed_size);
+            size_t off = 0;
+            for (auto&& frag : fragmented_temporary_buffer::view(payload)) {
+                std::copy_n(reinterpret_cast<const char*>(frag.data()), frag.size(), src.get() + off);
+                off += frag.size();
+            }
+            temporary_buffer<char> entries(uncompressed_size);
+            auto n = LZ4_decompress_safe(src.get(), entries.get_write(), compressed_size, uncompressed_size);
+            if (n < 0 || uint32_t(n) != uncompressed_size) {
+                clogger.debug("Could not decompress chunk at {}. Skipping chunk ({} bytes)", start, next - pos);
+                corrupt_size += next - pos;
+                pos = next;
+                co_return;
+            }
+
+            chunk_in.emplace(data_source(std::make_unique<chunk_data_source>(std::move(entries))));
+            std::exception_ptr ex;
+            try {
+                while (!end_of_chunk()) {
+                    co_await read_entry();
+                }
+            } catch (...) {
+                ex = std::current_exception();
+            }
+            co_await chunk_in->close();
+            chunk_in.reset();
+            if (ex) {
+                std::rethrow_exception(ex);
+            }
+        }
+
         using produce_func = std::function<future<>(buffer_and_replay_position, uint32_t)>;
 
         future<> produce(buffer_and_replay_position bar) {
@@ -2572,7 +2782,7 @@ db::commitlog::read_log_file(sstring filename, sstring pfx, seastar::io_priority
                 co_return;
             }
 
-            auto buf = co_await frag_reader.read_exactly(fin, entry_header_size);
+            auto buf = co_await frag_reader.read_exactly(entry_stream(), entry_header_size);
 
             replay_position rp(id, position_type(pos));
 
@@ -2594,7 +2804,7 @@ db::commitlog::read_log_file(sstring filename, sstring pfx, seastar::io_priority
 
                 assert(end <= next);
                 // really small read...
-                buf = co_await frag_reader.read_exactly(fin, sizeof(uint32_t));
+                buf = co_await frag_reader.read_exactly(entry_stream(), sizeof(uint32_t));
                 in = buf.get_istream();
                 checksum = read<uint32_t>(in);
 
@@ -2622,7 +2832,7 @@ db::commitlog::read_log_file(sstring filename, sstring pfx, seastar::io_priority
                     });
                 }
                 // and verify crc.
-                buf = co_await frag_reader.read_exactly(fin, sizeof(uint32_t)); 
+                buf = co_await frag_reader.read_exactly(entry_stream(), sizeof(uint32_t)); 
                 in = buf.get_istream();
                 checksum = read<uint32_t>(in);
 
@@ -2656,7 +2866,7 @@ db::commitlog::read_log_file(sstring filename, sstring pfx, seastar::io_priority
                 co_return;
             }
 
-            buf = co_await frag_reader.read_exactly(fin, size - entry_header_size);
+            buf = co_await frag_reader.read_exactly(entry_stream(), size - entry_header_size);
 
             advance(buf);
 
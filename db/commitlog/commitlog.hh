@@ -109,6 +109,9 @@ public:
         bool use_o_dsync = false;
         bool warn_about_segments_left_on_disk_after_shutdown = true;
         bool allow_going_over_size_limit = true;
+        // Compress each flushed batch with LZ4, trading CPU for disk
+        // bandwidth. New segments are written in version 3 format.
+        bool use_compression = false;
 
         // The base segment ID to use.
         // The segment IDs of newly allocated segments will be issued sequentially
@@ -133,6 +136,9 @@ public:
 
         static inline constexpr uint32_t segment_version_1 = 1u;
         static inline constexpr uint32_t segment_version_2 = 2u;
+        // Version 3 chunks carry a sub-header with payload sizes and may
+        // hold their entries LZ4-compressed.
+        static inline constexpr uint32_t segment_version_3 = 3u;
 
         descriptor(descriptor&&) noexcept = default;
         descriptor(const descriptor&) = default;
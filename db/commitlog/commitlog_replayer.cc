@@ -14,6 +14,7 @@
 #include <boost/range/adaptor/map.hpp>
 
 #include <seastar/core/future.hh>
+#include <seastar/core/loop.hh>
 #include <seastar/core/sharded.hh>
 
 #include "commitlog.hh"
@@ -339,11 +340,14 @@ future<> db::commitlog_replayer::recover(std::vector<sstring> files, sstring fna
             return map_reduce(smp::all_cpus(), [this, map, &fname_prefix] (unsigned id) {
                 return smp::submit_to(id, [this, id, map, &fname_prefix] () {
                     auto total = ::make_lw_shared<impl::stats>();
-                    // TODO: or something. For now, we do this serialized per shard,
-                    // to reduce mutation congestion. We could probably (says avi)
-                    // do 2 segments in parallel or something, but lets use this first.
+                    // Segments of one shard can be replayed in parallel: entries
+                    // are filtered by their replay position alone, and applying
+                    // mutations is a commutative merge, so ordering across
+                    // segments doesn't matter. Keep the fan-out modest to limit
+                    // mutation congestion on the target shards.
+                    constexpr unsigned segment_replay_concurrency = 4;
                     auto range = map->equal_range(id);
-                    return do_for_each(range.first, range.second, [this, total, &fname_prefix] (const std::pair<unsigned, sstring>& p) {
+                    return max_concurrent_for_each(range.first, range.second, segment_replay_concurrency, [this, total, &fname_prefix] (const std::pair<unsigned, sstring>& p) {
                         auto&f = p.second;
                         rlogger.debug("Replaying {}", f);
                         return _impl->recover(f, fname_prefix).then([f, total](impl::stats stats) {
@@ -433,6 +433,8 @@ db::config::config(std::shared_ptr<db::extensions> exts)
         "Whether or not to use O_DSYNC mode for commitlog segments IO. Can improve commitlog latency on some file systems.\n")
     , commitlog_use_hard_size_limit(this, "commitlog_use_hard_size_limit", value_status::Used, false,
         "Whether or not to use a hard size limit for commitlog disk usage. Default is false. Enabling this can cause latency spikes, whereas the default can lead to occasional disk usage peaks.\n")
+    , commitlog_use_compression(this, "commitlog_use_compression", value_status::Used, false,
+        "Whether or not to compress each commitlog flush batch with LZ4 before writing it to disk, trading CPU for commitlog disk bandwidth. Only affects newly written segments; segments written with compression enabled can always be replayed.\n")
     /* Compaction settings */
     /* Related information: Configuring compaction */
     , compaction_preheat_key_cache(this, "compaction_preheat_key_cache", value_status::Unused, true,
@@ -446,6 +448,7 @@ db::config::config(std::shared_ptr<db::extensions> exts)
     , sstable_preemptive_open_interval_in_mb(this, "sstable_preemptive_open_interval_in_mb", value_status::Unused, 50,
         "When compacting, the replacement opens SSTables before they are completely written and uses in place of the prior SSTables for any range previously written. This setting helps to smoothly transfer reads between the SSTables by reducing page cache churn and keeps hot rows hot.")
     , defragment_memory_on_idle(this, "defragment_memory_on_idle", value_status::Used, false, "When set to true, will defragment memory when the cpu is idle.  This reduces the amount of work Scylla performs when processing client requests.")
+    , defragment_memory_max_occupancy(this, "defragment_memory_max_occupancy", value_status::Used, 0.85, "Maximum occupancy (0.0-1.0) of an LSA segment for idle-time defragmentation to consider compacting it. Lower values make idle defragmentation spend its cycles only on the most fragmented segments; 1.0 compacts anything compactible. Only relevant when defragment_memory_on_idle is set.")
     /* Memtable settings */
     , memtable_allocation_type(this, "memtable_allocation_type", value_status::Invalid, "heap_buffers",
         "Specify the way Cassandra allocates and manages memtable memory. See Off-heap memtables in Cassandra 2.1. Options are:\n"
@@ -470,9 +473,9 @@ db::config::config(std::shared_ptr<db::extensions> exts)
         "Granularity of the index of rows within a partition. For huge rows, decrease this setting to improve seek time. If you use key cache, be careful not to make this setting too large because key cache will be overwhelmed. If you're unsure of the size of the rows, it's best to use the default setting.")
     , column_index_auto_scale_threshold_in_kb(this, "column_index_auto_scale_threshold_in_kb", liveness::LiveUpdate, value_status::Used, 10240,
         "Auto-reduce the promoted index granularity by half when reaching this threshold, to prevent promoted index bloating due to partitions with too many rows. Set to 0 to disable this feature.")
-    , index_summary_capacity_in_mb(this, "index_summary_capacity_in_mb", value_status::Unused, 0,
-        "Fixed memory pool size in MB for SSTable index summaries. If the memory usage of all index summaries exceeds this limit, any SSTables with low read rates shrink their index summaries to meet this limit. This is a best-effort process. In extreme conditions, Cassandra may need to use more than this amount of memory.")
-    , index_summary_resize_interval_in_minutes(this, "index_summary_resize_interval_in_minutes", value_status::Unused, 60,
+    , index_summary_capacity_in_mb(this, "index_summary_capacity_in_mb", value_status::Used, 0,
+        "Memory budget for SSTable index summaries, shared evenly between shards. If the memory used by all index summaries exceeds this limit, SSTables with low read rates shrink their index summaries to meet this limit. This is a best-effort process; summaries of SSTables being read are not shrunk. Set to 0 (the default) to budget 5% of shard memory.")
+    , index_summary_resize_interval_in_minutes(this, "index_summary_resize_interval_in_minutes", value_status::Used, 60,
         "How frequently index summaries should be re-sampled. This is done periodically to redistribute memory from the fixed-size pool to SSTables proportional their recent read rates. To disable, set to -1. This leaves existing index summaries at their current sampling level.")
     , reduce_cache_capacity_to(this, "reduce_cache_capacity_to", value_status::Invalid, .6,
         "Sets the size percentage to which maximum cache capacity is reduced when Java heap usage reaches the threshold defined by reduce_cache_sizes_at. Together with flush_largest_memtables_at, these properties constitute an emergency measure for preventing sudden out-of-memory (OOM) errors.")
@@ -804,6 +807,7 @@ db::config::config(std::shared_ptr<db::extensions> exts)
     , abort_on_lsa_bad_alloc(this, "abort_on_lsa_bad_alloc", value_status::Used, false, "Abort when allocation in LSA region fails")
     , murmur3_partitioner_ignore_msb_bits(this, "murmur3_partitioner_ignore_msb_bits", value_status::Used, 12, "Number of most siginificant token bits to ignore in murmur3 partitioner; increase for very large clusters")
     , virtual_dirty_soft_limit(this, "virtual_dirty_soft_limit", value_status::Used, 0.6, "Soft limit of virtual dirty memory expressed as a portion of the hard limit")
+    , memtable_flush_derivative_gain(this, "memtable_flush_derivative_gain", value_status::Used, 0.0, "Gain applied to the growth of the virtual dirty ratio between flush controller adjustments. When non-zero, flush shares ramp up while an ingest burst is still filling memtables instead of after the dirty thresholds are crossed, smoothing flush I/O and reducing write throttling. 0 disables the derivative term.")
     , sstable_summary_ratio(this, "sstable_summary_ratio", value_status::Used, 0.0005, "Enforces that 1 byte of summary is written for every N (2000 by default) "
         "bytes written to data file. Value must be between 0 and 1.")
     , large_memory_allocation_warning_threshold(this, "large_memory_allocation_warning_threshold", value_status::Used, size_t(1) << 20, "Warn about memory allocations above this size; set to zero to disable")
@@ -835,6 +839,10 @@ db::config::config(std::shared_ptr<db::extensions> exts)
     , max_memory_for_unlimited_query_hard_limit(this, "max_memory_for_unlimited_query_hard_limit", "max_memory_for_unlimited_query", liveness::LiveUpdate, value_status::Used, (uint64_t(100) << 20),
             "Maximum amount of memory a query, whose memory consumption is not naturally limited, is allowed to consume, e.g. non-paged and reverse queries. "
             "This is the hard limit, queries violating this limit will be aborted.")
+    , querier_cache_entry_ttl_in_seconds(this, "querier_cache_entry_ttl_in_seconds", value_status::Used, 10,
+            "Time-to-live of the readers saved between pages of a paged query. Clients which fetch consecutive pages slower than this will "
+            "have the saved reader evicted and each page will have to re-create it. Saved readers are evicted before their TTL expires if "
+            "their resources are needed for other reads, regardless of this setting.")
     , initial_sstable_loading_concurrency(this, "initial_sstable_loading_concurrency", value_status::Used, 4u,
             "Maximum amount of sstables to load in parallel during initialization. A higher number can lead to more memory consumption. You should not need to touch this")
     , enable_3_1_0_compatibility_mode(this, "enable_3_1_0_compatibility_mode", value_status::Used, false,
@@ -176,12 +176,14 @@ public:
     named_value<int64_t> commitlog_flush_threshold_in_mb;
     named_value<bool> commitlog_use_o_dsync;
     named_value<bool> commitlog_use_hard_size_limit;
+    named_value<bool> commitlog_use_compression;
     named_value<bool> compaction_preheat_key_cache;
     named_value<uint32_t> concurrent_compactors;
     named_value<uint32_t> in_memory_compaction_limit_in_mb;
     named_value<bool> preheat_kernel_page_cache;
     named_value<uint32_t> sstable_preemptive_open_interval_in_mb;
     named_value<bool> defragment_memory_on_idle;
+    named_value<double> defragment_memory_max_occupancy;
     named_value<sstring> memtable_allocation_type;
     named_value<double> memtable_cleanup_threshold;
     named_value<uint32_t> file_cache_size_in_mb;
@@ -311,6 +313,7 @@ public:
     named_value<bool> abort_on_lsa_bad_alloc;
     named_value<unsigned> murmur3_partitioner_ignore_msb_bits;
     named_value<double> virtual_dirty_soft_limit;
+    named_value<double> memtable_flush_derivative_gain;
     named_value<double> sstable_summary_ratio;
     named_value<size_t> large_memory_allocation_warning_threshold;
     named_value<bool> enable_deprecated_partitioners;
@@ -330,6 +333,7 @@ public:
     named_value<uint32_t> max_clustering_key_restrictions_per_query;
     named_value<uint64_t> max_memory_for_unlimited_query_soft_limit;
     named_value<uint64_t> max_memory_for_unlimited_query_hard_limit;
+    named_value<uint32_t> querier_cache_entry_ttl_in_seconds;
     named_value<unsigned> initial_sstable_loading_concurrency;
     named_value<bool> enable_3_1_0_compatibility_mode;
     named_value<bool> enable_user_defined_functions;
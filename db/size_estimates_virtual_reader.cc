@@ -159,12 +159,27 @@ static dht::partition_range as_ring_position_range(dht::token_range& r) {
     return dht::partition_range(std::move(start_bound), std::move(end_bound), r.is_singular());
 }
 
+/**
+ * An sstable's contribution to the mean partition size, precomputed from its
+ * estimated_partition_size histogram. The histogram is a property of the
+ * sstable, not of the queried range, so it is folded down to these two
+ * numbers once per sstable and reused for every local range the sstable
+ * overlaps, instead of merging the whole histogram again per range.
+ */
+struct sstable_size_stats {
+    int64_t partitions = 0;
+    int64_t size_sum = 0;
+};
+using sstable_size_stats_map = std::unordered_map<const sstables::sstable*, sstable_size_stats>;
+
 /**
  * Add a new range_estimates for the specified range, considering the sstables associated with `cf`.
  */
-static system_keyspace::range_estimates estimate(const replica::column_family& cf, const token_range& r) {
+static system_keyspace::range_estimates estimate(const replica::column_family& cf, const token_range& r,
+        sstable_size_stats_map& size_stats) {
     int64_t count{0};
-    utils::estimated_histogram hist{0};
+    int64_t partitions{0};
+    int64_t size_sum{0};
     auto from_bytes = [] (auto& b) {
         return dht::token::from_sstring(utf8_type->to_string(b));
     };
@@ -177,10 +192,22 @@ static system_keyspace::range_estimates estimate(const replica::column_family& c
         auto rp_range = as_ring_position_range(r);
         for (auto&& sstable : cf.select_sstables(rp_range)) {
             count += sstable->estimated_keys_for_range(r);
-            hist.merge(sstable->get_stats_metadata().estimated_partition_size);
+            auto [it, inserted] = size_stats.try_emplace(sstable.get());
+            if (inserted) {
+                // Mirrors utils::estimated_histogram::mean(): the last
+                // (overflow) bucket is excluded.
+                const auto& hist = sstable->get_stats_metadata().estimated_partition_size;
+                for (size_t i = 0; i + 1 < hist.buckets.size(); i++) {
+                    it->second.partitions += hist.buckets[i];
+                    it->second.size_sum += hist.buckets[i] * hist.bucket_offsets[i];
+                }
+            }
+            partitions += it->second.partitions;
+            size_sum += it->second.size_sum;
         }
     }
-    return {cf.schema(), r.start, r.end, count, count > 0 ? hist.mean() : 0};
+    auto mean_size = partitions ? int64_t((double(size_sum) + partitions - 1) / partitions) : 0;
+    return {cf.schema(), r.start, r.end, count, count > 0 ? mean_size : 0};
 }
 
 /**
@@ -318,6 +345,7 @@ size_estimates_mutation_reader::estimates_for_current_keyspace(std::vector<token
         return utf8_type->less(n1, n2);
     });
     std::vector<db::system_keyspace::range_estimates> estimates;
+    sstable_size_stats_map size_stats;
     for (auto& range : _slice.row_ranges(*_schema, pkey)) {
         auto rows = boost::make_iterator_range(
                 virtual_row_iterator(cf_names, local_ranges),
@@ -325,7 +353,7 @@ size_estimates_mutation_reader::estimates_for_current_keyspace(std::vector<token
         auto rows_to_estimate = range.slice(rows, virtual_row_comparator(_schema));
         for (auto&& r : rows_to_estimate) {
             auto& cf = _db.find_column_family(*_current_partition, utf8_type->to_string(r.cf_name));
-            estimates.push_back(estimate(cf, r.tokens));
+            estimates.push_back(estimate(cf, r.tokens, size_stats));
             if (estimates.size() >= _slice.partition_row_limit()) {
                 return estimates;
             }
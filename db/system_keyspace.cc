@@ -14,6 +14,7 @@
 #include <boost/range/adaptor/map.hpp>
 
 #include <seastar/core/coroutine.hh>
+#include <seastar/coroutine/all.hh>
 #include <seastar/coroutine/maybe_yield.hh>
 #include <seastar/core/reactor.hh>
 #include <seastar/json/json_elements.hh>
@@ -54,6 +55,7 @@
 #include "db/schema_tables.hh"
 #include "index/built_indexes_virtual_reader.hh"
 #include "utils/generation-number.hh"
+#include "utils/logalloc.hh"
 #include "db/virtual_table.hh"
 #include "service/storage_service.hh"
 #include "gms/gossiper.hh"
@@ -1326,15 +1328,19 @@ future<> system_keyspace::build_bootstrap_info() {
 future<> system_keyspace::setup(sharded<netw::messaging_service>& ms) {
     assert(this_shard_id() == 0);
 
-    co_await setup_version(ms);
-    co_await update_schema_version(_db.local().get_version());
-    co_await build_dc_rack_info();
-    co_await build_bootstrap_info();
-    co_await check_health();
+    // These steps read and write disjoint rows and columns of the system
+    // tables, so run them concurrently instead of serializing half a dozen
+    // single-row internal queries at the most latency-critical boot phase.
+    co_await coroutine::all(
+        [&] { return setup_version(ms); },
+        [&] { return update_schema_version(_db.local().get_version()); },
+        [&] { return build_dc_rack_info(); },
+        [&] { return build_bootstrap_info(); },
+        [&] { return check_health(); },
+        [&] { return cache_truncation_record(); });
     co_await db::schema_tables::save_system_keyspace_schema(_qp.local());
     // #2514 - make sure "system" is written to system_schema.keyspaces.
     co_await db::schema_tables::save_system_schema(_qp.local(), NAME);
-    co_await cache_truncation_record();
     auto preferred_ips = co_await get_preferred_ips();
     co_await ms.invoke_on_all([&preferred_ips] (auto& ms) {
         return ms.init_local_preferred_ip_cache(preferred_ips);
@@ -2603,6 +2609,175 @@ public:
     }
 };
 
+class live_large_partitions_table : public memtable_filling_virtual_table {
+    distributed<replica::database>& _db;
+public:
+    explicit live_large_partitions_table(distributed<replica::database>& db)
+            : memtable_filling_virtual_table(build_schema())
+            , _db(db) {}
+
+    static schema_ptr build_schema() {
+        auto id = generate_legacy_id(system_keyspace::NAME, "live_large_partitions");
+        return schema_builder(system_keyspace::NAME, "live_large_partitions", std::make_optional(id))
+            .with_column("keyspace_name", utf8_type, column_kind::partition_key)
+            .with_column("table_name", utf8_type, column_kind::clustering_key)
+            .with_column("partition_key", utf8_type, column_kind::clustering_key)
+            .with_column("estimated_write_bytes", long_type)
+            .with_column("detected_at", timestamp_type)
+            .set_comment("Partitions whose recent write volume crossed the large partition warning threshold, "
+                         "detected on the write path. Sizes are estimates of the bytes written to the partition "
+                         "within the sampling window, not of its size on disk.")
+            .with_version(system_keyspace::generate_schema_version(id))
+            .build();
+    }
+
+    future<> execute(std::function<void(mutation)> mutation_sink) override {
+        struct entry {
+            sstring table_name;
+            sstring partition_key;
+            int64_t estimated_write_bytes;
+            db_clock::time_point detected_at;
+        };
+        using entries_by_keyspace_map = std::map<sstring, std::vector<entry>>;
+
+        auto merged = co_await _db.map_reduce0([] (replica::database& db) {
+            entries_by_keyspace_map local;
+            for (auto& [_, table] : db.get_column_families()) {
+                const auto& s = *table->schema();
+                for (const auto& e : table->live_large_partitions()) {
+                    auto key_str = format("{}", e.key.key().with_schema(s));
+                    local[s.ks_name()].push_back(entry{s.cf_name(), std::move(key_str), int64_t(e.estimated_write_bytes), e.detected_at});
+                }
+            }
+            return local;
+        }, entries_by_keyspace_map{}, [] (entries_by_keyspace_map res, entries_by_keyspace_map&& local) {
+            for (auto& [ks_name, entries] : local) {
+                auto& merged_entries = res[ks_name];
+                std::move(entries.begin(), entries.end(), std::back_inserter(merged_entries));
+            }
+            return res;
+        });
+
+        for (auto& [ks_name, entries] : merged) {
+            mutation m(schema(), partition_key::from_single_value(*schema(), data_value(ks_name).serialize_nonnull()));
+            for (auto& e : entries) {
+                auto ck = clustering_key::from_exploded(*schema(), {
+                    data_value(e.table_name).serialize_nonnull(),
+                    data_value(e.partition_key).serialize_nonnull()
+                });
+                row& cr = m.partition().clustered_row(*schema(), ck).cells();
+                set_cell(cr, "estimated_write_bytes", e.estimated_write_bytes);
+                set_cell(cr, "detected_at", e.detected_at);
+            }
+            mutation_sink(std::move(m));
+        }
+    }
+};
+
+class memory_breakdown_table : public memtable_filling_virtual_table {
+    distributed<replica::database>& _db;
+
+    struct table_entry {
+        sstring ks_name;
+        sstring cf_name;
+        int64_t memtable_bytes;
+        int64_t memtable_used_bytes;
+        int64_t sstable_filter_bytes;
+        int64_t sstable_summary_bytes;
+    };
+    struct shard_breakdown {
+        int64_t cache_bytes = 0;
+        int64_t cache_used_bytes = 0;
+        int64_t lsa_bytes = 0;
+        int64_t lsa_free_bytes = 0;
+        int64_t reader_permit_bytes = 0;
+        std::vector<table_entry> tables;
+    };
+public:
+    explicit memory_breakdown_table(distributed<replica::database>& db)
+            : memtable_filling_virtual_table(build_schema())
+            , _db(db) {
+        _shard_aware = true;
+    }
+
+    static schema_ptr build_schema() {
+        auto id = generate_legacy_id(system_keyspace::NAME, "memory_breakdown");
+        return schema_builder(system_keyspace::NAME, "memory_breakdown", std::make_optional(id))
+            .with_column("shard", int32_type, column_kind::partition_key)
+            .with_column("keyspace_name", utf8_type, column_kind::clustering_key)
+            .with_column("table_name", utf8_type, column_kind::clustering_key)
+            .with_column("cache_bytes", long_type, column_kind::static_column)
+            .with_column("cache_used_bytes", long_type, column_kind::static_column)
+            .with_column("lsa_bytes", long_type, column_kind::static_column)
+            .with_column("lsa_free_bytes", long_type, column_kind::static_column)
+            .with_column("reader_permit_bytes", long_type, column_kind::static_column)
+            .with_column("memtable_bytes", long_type)
+            .with_column("memtable_used_bytes", long_type)
+            .with_column("sstable_filter_bytes", long_type)
+            .with_column("sstable_summary_bytes", long_type)
+            .set_comment("Live breakdown of a shard's memory. Per-table rows cover memtables and the "
+                         "in-memory sstable components (bloom filters and summaries); the static columns "
+                         "cover shard-wide pools: the row cache, the log-structured allocator (lsa_free_bytes "
+                         "is free space trapped inside allocated segments) and memory held by reader permits.")
+            .with_version(system_keyspace::generate_schema_version(id))
+            .build();
+    }
+
+    future<> execute(std::function<void(mutation)> mutation_sink) override {
+        for (auto shard : boost::irange(0u, smp::count)) {
+            auto dk = dht::decorate_key(*_s, partition_key::from_single_value(*schema(), data_value(int32_t(shard)).serialize_nonnull()));
+            if (!this_shard_owns(dk)) {
+                continue;
+            }
+            auto bd = co_await _db.invoke_on(shard, [] (replica::database& db) {
+                shard_breakdown bd;
+                auto cache_occupancy = db.row_cache_tracker().region().occupancy();
+                bd.cache_bytes = cache_occupancy.total_space();
+                bd.cache_used_bytes = cache_occupancy.used_space();
+                auto lsa_occupancy = logalloc::shard_tracker().region_occupancy();
+                bd.lsa_bytes = lsa_occupancy.total_space();
+                bd.lsa_free_bytes = lsa_occupancy.free_space();
+                auto& semaphore = db.get_reader_concurrency_semaphore();
+                bd.reader_permit_bytes = semaphore.initial_resources().memory - semaphore.available_resources().memory;
+                for (auto& [_, t] : db.get_column_families()) {
+                    const auto& s = *t->schema();
+                    auto memtable_occupancy = t->occupancy();
+                    int64_t filter_bytes = 0;
+                    int64_t summary_bytes = 0;
+                    for (auto& sst : *t->get_sstables()) {
+                        filter_bytes += sst->filter_memory_size();
+                        summary_bytes += sst->get_summary().memory_footprint();
+                    }
+                    bd.tables.push_back(table_entry{s.ks_name(), s.cf_name(),
+                            int64_t(memtable_occupancy.total_space()), int64_t(memtable_occupancy.used_space()),
+                            filter_bytes, summary_bytes});
+                }
+                return bd;
+            });
+
+            auto ts = api::new_timestamp();
+            mutation m(schema(), dk);
+            m.set_static_cell("cache_bytes", data_value(bd.cache_bytes), ts);
+            m.set_static_cell("cache_used_bytes", data_value(bd.cache_used_bytes), ts);
+            m.set_static_cell("lsa_bytes", data_value(bd.lsa_bytes), ts);
+            m.set_static_cell("lsa_free_bytes", data_value(bd.lsa_free_bytes), ts);
+            m.set_static_cell("reader_permit_bytes", data_value(bd.reader_permit_bytes), ts);
+            for (auto& e : bd.tables) {
+                auto ck = clustering_key::from_exploded(*schema(), {
+                    data_value(e.ks_name).serialize_nonnull(),
+                    data_value(e.cf_name).serialize_nonnull()
+                });
+                row& cr = m.partition().clustered_row(*schema(), ck).cells();
+                set_cell(cr, "memtable_bytes", e.memtable_bytes);
+                set_cell(cr, "memtable_used_bytes", e.memtable_used_bytes);
+                set_cell(cr, "sstable_filter_bytes", e.sstable_filter_bytes);
+                set_cell(cr, "sstable_summary_bytes", e.sstable_summary_bytes);
+            }
+            mutation_sink(std::move(m));
+        }
+    }
+};
+
 // Map from table's schema ID to table itself. Helps avoiding accidental duplication.
 static thread_local std::map<utils::UUID, std::unique_ptr<virtual_table>> virtual_tables;
 
@@ -2624,6 +2799,8 @@ void register_virtual_tables(distributed<replica::database>& dist_db, distribute
     add_table(std::make_unique<versions_table>());
     add_table(std::make_unique<db_config_table>(cfg));
     add_table(std::make_unique<clients_table>(ss));
+    add_table(std::make_unique<live_large_partitions_table>(dist_db));
+    add_table(std::make_unique<memory_breakdown_table>(dist_db));
 }
 
 std::vector<schema_ptr> system_keyspace::all_tables(const db::config& cfg) {
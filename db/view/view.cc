@@ -43,6 +43,7 @@
 #include "mutation.hh"
 #include "mutation_partition.hh"
 #include "service/migration_manager.hh"
+#include "service/priority_manager.hh"
 #include "service/storage_proxy.hh"
 #include "view_info.hh"
 #include "view_update_checks.hh"
@@ -1177,15 +1178,32 @@ future<query::clustering_row_ranges> calculate_affected_clustering_ranges(const
 //
 // If the assumption that the given base token belongs to this replica
 // does not hold, we return an empty optional.
+// The replication-map state shared by all view updates generated from one
+// base mutation. All views live in the base table's keyspace, so it only
+// needs to be computed once per mutate_MV() call rather than per update.
+struct view_natural_endpoint_context {
+    locator::effective_replication_map_ptr erm;
+    bool network_topology;
+    gms::inet_address my_address;
+    sstring my_datacenter;
+
+    explicit view_natural_endpoint_context(const sstring& keyspace_name) {
+        auto& db = service::get_local_storage_proxy().local_db();
+        auto& ks = db.find_keyspace(keyspace_name);
+        erm = ks.get_effective_replication_map();
+        network_topology = dynamic_cast<const locator::network_topology_strategy*>(&ks.get_replication_strategy());
+        my_address = utils::fb_utilities::get_broadcast_address();
+        my_datacenter = locator::i_endpoint_snitch::get_local_snitch_ptr()->get_datacenter(my_address);
+    }
+};
+
 static std::optional<gms::inet_address>
-get_view_natural_endpoint(const sstring& keyspace_name,
+get_view_natural_endpoint(const view_natural_endpoint_context& ctx,
         const dht::token& base_token, const dht::token& view_token) {
-    auto &db = service::get_local_storage_proxy().local_db();
-    auto& ks = db.find_keyspace(keyspace_name);
-    auto erm = ks.get_effective_replication_map();
-    auto my_address = utils::fb_utilities::get_broadcast_address();
-    auto my_datacenter = locator::i_endpoint_snitch::get_local_snitch_ptr()->get_datacenter(my_address);
-    bool network_topology = dynamic_cast<const locator::network_topology_strategy*>(&ks.get_replication_strategy());
+    const auto& erm = ctx.erm;
+    const auto& my_address = ctx.my_address;
+    const auto& my_datacenter = ctx.my_datacenter;
+    bool network_topology = ctx.network_topology;
     std::vector<gms::inet_address> base_endpoints, view_endpoints;
     for (auto&& base_endpoint : erm->get_natural_endpoints(base_token)) {
         if (!network_topology || locator::i_endpoint_snitch::get_local_snitch_ptr()->get_datacenter(base_endpoint) == my_datacenter) {
@@ -1249,19 +1267,31 @@ future<> mutate_MV(
         service::allow_hints allow_hints,
         wait_for_all_updates wait_for_all)
 {
+    if (view_updates.empty()) {
+        co_return;
+    }
+    // Updates generated from a single base mutation all target views of the
+    // same base table, which live in its keyspace. Resolve the replication
+    // map and token metadata once instead of once per update; with many views
+    // per base table these lookups used to dominate the per-update cost. The
+    // effective_replication_map_ptr also keeps the maps alive for the
+    // duration of the endpoint computations.
+    auto& keyspace_name = view_updates.front().s->ks_name();
+    view_natural_endpoint_context endpoint_ctx(keyspace_name);
+    auto tmptr = service::get_local_storage_proxy().get_token_metadata_ptr();
+
     static constexpr size_t max_concurrent_updates = 128;
     co_await max_concurrent_for_each(view_updates, max_concurrent_updates,
-            [base_token, &stats, &cf_stats, tr_state, &pending_view_updates, allow_hints, wait_for_all] (frozen_mutation_and_schema mut) mutable -> future<> {
+            [base_token, &stats, &cf_stats, tr_state, &pending_view_updates, allow_hints, wait_for_all, &keyspace_name, &endpoint_ctx, &tmptr] (frozen_mutation_and_schema mut) mutable -> future<> {
         auto view_token = dht::get_token(*mut.s, mut.fm.key());
-        auto& keyspace_name = mut.s->ks_name();
-        auto target_endpoint = get_view_natural_endpoint(keyspace_name, base_token, view_token);
-        auto remote_endpoints = service::get_local_storage_proxy().get_token_metadata_ptr()->pending_endpoints_for(view_token, keyspace_name);
+        auto target_endpoint = get_view_natural_endpoint(endpoint_ctx, base_token, view_token);
+        auto remote_endpoints = tmptr->pending_endpoints_for(view_token, keyspace_name);
         auto sem_units = pending_view_updates.split(mut.fm.representation().size());
 
         // First, find the local endpoint and ensure that if it exists,
         // it will be the target endpoint. That way, all endpoints in the
         // remote_endpoints list are guaranteed to be remote.
-        auto my_address = utils::fb_utilities::get_broadcast_address();
+        const auto& my_address = endpoint_ctx.my_address;
         auto remote_it = std::find(remote_endpoints.begin(), remote_endpoints.end(), my_address);
         if (remote_it != remote_endpoints.end()) {
             if (!target_endpoint) {
@@ -1494,12 +1524,15 @@ future<> view_builder::initialize_reader_at_current_token(build_step& step) {
   return step.reader.close().then([this, &step] {
     step.pslice = make_partition_slice(*step.base->schema());
     step.prange = dht::partition_range(dht::ring_position::starting_at(step.current_token()), dht::ring_position::max());
+    // Scans sstables directly, bypassing the row cache, so building a view
+    // on a large base table doesn't evict the hot working set. The streaming
+    // priority keeps its disk reads out of the way of foreground requests.
     step.reader = step.base->get_sstable_set().make_local_shard_sstable_reader(
             step.base->schema(),
             _permit,
             step.prange,
             step.pslice,
-            default_priority_class(),
+            service::get_local_streaming_priority(),
             nullptr,
             streamed_mutation::forwarding::no,
             mutation_reader::forwarding::no);
@@ -1814,7 +1847,10 @@ void view_builder::on_drop_view(const sstring& ks_name, const sstring& view_name
 }
 
 future<> view_builder::do_build_step() {
-    return seastar::async([this] {
+    // Build steps compete with streaming, not with foreground work.
+    thread_attributes attr;
+    attr.sched_group = _db.get_streaming_scheduling_group();
+    return seastar::async(std::move(attr), [this] {
         exponential_backoff_retry r(1s, 1min);
         while (!_base_to_build_step.empty() && !_as.abort_requested()) {
             auto units = get_units(_sem, 1).get0();
@@ -38,6 +38,14 @@ range_streamer::get_range_fetch_map(const std::unordered_map<dht::token_range, s
         const dht::token_range& range_ = x.first;
         const std::vector<inet_address>& addresses = x.second;
         bool found_source = false;
+        // Out of the acceptable sources, pick the one with the fewest ranges
+        // assigned so far, breaking ties by the proximity order the sources
+        // arrive in. Always taking the closest source piles most ranges onto
+        // a few peers, and the whole operation then runs at the pace of the
+        // most loaded one; spreading ranges evenly across the candidate
+        // replicas lets all of them stream in parallel.
+        std::optional<inet_address> best_source;
+        size_t best_source_load = 0;
         for (auto address : addresses) {
             if (address == utils::fb_utilities::get_broadcast_address()) {
                 // If localhost is a source, we have found one, but we don't add it to the map to avoid streaming locally
@@ -58,9 +66,17 @@ range_streamer::get_range_fetch_map(const std::unordered_map<dht::token_range, s
                 continue;
             }
 
-            range_fetch_map_map[address].push_back(range_);
+            auto it = range_fetch_map_map.find(address);
+            auto load = it == range_fetch_map_map.end() ? 0 : it->second.size();
+            if (!best_source || load < best_source_load) {
+                best_source = address;
+                best_source_load = load;
+            }
+        }
+        if (best_source) {
+            // Still stream each range from only one other node.
+            range_fetch_map_map[*best_source].push_back(range_);
             found_source = true;
-            break; // ensure we only stream from one other node for each range
         }
 
         if (!found_source) {
@@ -285,7 +285,7 @@ public:
      * @param ep_state
      * @return
      */
-    int get_max_endpoint_state_version(endpoint_state state) const noexcept;
+    int get_max_endpoint_state_version(const endpoint_state& state) const noexcept;
 
 
 private:
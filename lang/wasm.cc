@@ -66,6 +66,15 @@ static wasmtime::Val call_func(wasmtime::Store& store, wasmtime::Func func, std:
     return std::move(result_vec[0]);
 }
 
+static wasmtime::Memory get_memory(wasmtime::Instance& instance, wasmtime::Store& store) {
+    // `memory` is required to be exported in the WebAssembly module
+    auto memory_export = instance.get(store, "memory");
+    if (!memory_export) {
+        throw wasm::exception("memory export not found - please export `memory` in the wasm module");
+    }
+    return std::get<wasmtime::Memory>(*memory_export);
+}
+
 static std::pair<wasmtime::Instance, wasmtime::Func> create_instance_and_func(context& ctx, wasmtime::Store& store) {
     auto linker = wasmtime::Linker(ctx.engine_ptr->get());
     auto wasi_def = linker.define_wasi();
@@ -106,13 +115,8 @@ void compile(context& ctx, const std::vector<sstring>& arg_names, std::string sc
 }
 
 static void init_abstract_arg(const abstract_type& t, const bytes_opt& param, std::vector<wasmtime::Val>& argv, wasmtime::Store& store, wasmtime::Instance& instance) {
-        // set up exported memory's underlying buffer,
-        // `memory` is required to be exported in the WebAssembly module
-        auto memory_export = instance.get(store, "memory");
-        if (!memory_export) {
-            throw wasm::exception("memory export not found - please export `memory` in the wasm module");
-        }
-        auto memory = std::get<wasmtime::Memory>(*memory_export);
+        // set up exported memory's underlying buffer
+        auto memory = get_memory(instance, store);
         uint8_t* data = memory.data(store).data();
         size_t mem_size = memory.size(store) * WASM_PAGE_SIZE;
         int32_t serialized_size = param ? param->size() : 0;
@@ -249,11 +253,7 @@ struct from_val_visitor {
 
     bytes_opt operator()(const abstract_type& t) {
         expect_kind(wasmtime::ValKind::I64);
-        auto memory_export = instance.get(store, "memory");
-        if (!memory_export) {
-            throw wasm::exception("memory export not found - please export `memory` in the wasm module");
-        }
-        auto memory = std::get<wasmtime::Memory>(*memory_export);
+        auto memory = get_memory(instance, store);
         uint8_t* mem_base = memory.data(store).data();
         uint8_t* data = mem_base + (val.i64() & 0xffffffff);
         int32_t ret_size = val.i64() >> 32;
@@ -290,13 +290,31 @@ struct from_val_visitor {
 seastar::future<bytes_opt> run_script(context& ctx, const std::vector<data_type>& arg_types, const std::vector<bytes_opt>& params, data_type return_type, bool allow_null_input) {
     wasm_logger.debug("Running function {}", ctx.function_name);
 
-    auto store = wasmtime::Store(ctx.engine_ptr->get());
-    // Replenish the store with initial amount of fuel
-    auto added = store.context().add_fuel(ctx.engine_ptr->initial_fuel_amount());
-    if (!added) {
-        co_return coroutine::make_exception(wasm::exception(added.err().message()));
+    // Take the cached instance out of the context for the duration of the call,
+    // so that a reentrant call cannot touch it while it is in use. If this call
+    // leaves the instance reusable it is put back at the end.
+    auto entry = std::exchange(ctx.cached_instance, std::nullopt);
+    if (!entry) {
+        auto new_store = wasmtime::Store(ctx.engine_ptr->get());
+        auto [new_instance, new_func] = create_instance_and_func(ctx, new_store);
+        const auto memory_size = get_memory(new_instance, new_store).size(new_store);
+        entry.emplace(precompiled_instance{std::move(new_store), std::move(new_instance), std::move(new_func), memory_size, 0});
+    }
+    auto& store = entry->store;
+    auto& instance = entry->instance;
+    auto& func = entry->func;
+    // Replenish the store's fuel up to the per-call budget. The fuel left over
+    // from the previous call still counts towards the budget, so a reused
+    // instance gets the same preemption bound as a fresh one.
+    const uint64_t fuel_left = entry->total_fuel_added - *store.context().fuel_consumed();
+    if (fuel_left < ctx.engine_ptr->initial_fuel_amount()) {
+        const uint64_t fuel_to_add = ctx.engine_ptr->initial_fuel_amount() - fuel_left;
+        auto added = store.context().add_fuel(fuel_to_add);
+        if (!added) {
+            co_return coroutine::make_exception(wasm::exception(added.err().message()));
+        }
+        entry->total_fuel_added += fuel_to_add;
     }
-    auto [instance, func] = create_instance_and_func(ctx, store);
     std::vector<wasmtime::Val> argv;
     for (size_t i = 0; i < arg_types.size(); ++i) {
         const abstract_type& type = *arg_types[i];
@@ -339,13 +357,24 @@ seastar::future<bytes_opt> run_script(context& ctx, const std::vector<data_type>
     // wrappers for a few languages (C++, C, Rust), and see whether the ABI makes it easy
     // to interact with - we want to avoid poor user experience, and it's hard to judge it
     // before we actually have helper libraries.
+    bytes_opt ret;
     if (allow_null_input) {
         // Force calling the default method for abstract_type, which checks for nulls
         // and expects a serialized input
-        co_return from_val_visitor{result_vec[0], store, instance}(static_cast<const abstract_type&>(*return_type));
+        ret = from_val_visitor{result_vec[0], store, instance}(static_cast<const abstract_type&>(*return_type));
     } else {
-        co_return visit(*return_type, from_val_visitor{result_vec[0], store, instance});
+        ret = visit(*return_type, from_val_visitor{result_vec[0], store, instance});
+    }
+
+    // Keep the instance around for the next call only if this call left its
+    // linear memory at the post-instantiation size. ABI v1 grows the memory
+    // for each serialized argument and never shrinks it back, and a
+    // pathological module can grow its memory arbitrarily - recreating the
+    // instance in those cases doubles as the memory reset.
+    if (get_memory(instance, store).size(store) == entry->initial_memory_size) {
+        ctx.cached_instance = std::move(*entry);
     }
+    co_return ret;
 }
 
 }
@@ -25,10 +25,27 @@ public:
 
 #ifdef SCYLLA_ENABLE_WASMTIME
 
+// A pre-instantiated runtime instance of the function's module, kept between
+// calls so that repeated calls - e.g. a scan applying a scalar UDF to every
+// row - skip the per-call module instantiation. The instance is only reused
+// if the previous call left the module's linear memory at the size it had
+// right after instantiation, see run_script().
+struct precompiled_instance {
+    wasmtime::Store store;
+    wasmtime::Instance instance;
+    wasmtime::Func func;
+    // Size of the module's linear memory right after instantiation, in wasm pages.
+    size_t initial_memory_size;
+    // Total amount of fuel ever added to the store, for topping the fuel
+    // back up to the per-call budget before each call.
+    uint64_t total_fuel_added;
+};
+
 struct context {
     wasm::engine* engine_ptr;
     std::optional<wasmtime::Module> module;
     std::string function_name;
+    std::optional<precompiled_instance> cached_instance;
 
     context(wasm::engine* engine_ptr, std::string name);
 };
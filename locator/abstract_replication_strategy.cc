@@ -67,9 +67,7 @@ sstring abstract_replication_strategy::to_qualified_class_name(std::string_view
 }
 
 inet_address_vector_replica_set abstract_replication_strategy::get_natural_endpoints(const token& search_token, const effective_replication_map& erm) const {
-    const token& key_token = erm.get_token_metadata_ptr()->first_token(search_token);
-    auto res = erm.get_replication_map().find(key_token);
-    return res->second;
+    return erm.get_replica_set_for_token(search_token);
 }
 
 inet_address_vector_replica_set effective_replication_map::get_natural_endpoints_without_node_being_replaced(const token& search_token) const {
@@ -309,7 +307,27 @@ future<mutable_effective_replication_map_ptr> calculate_effective_replication_ma
     }
 
     auto rf = rs->get_replication_factor(*tmptr);
-    co_return make_effective_replication_map(std::move(rs), std::move(tmptr), std::move(replication_map), rf);
+    co_return co_await make_effective_replication_map(std::move(rs), std::move(tmptr), std::move(replication_map), rf);
+}
+
+future<mutable_effective_replication_map_ptr> make_effective_replication_map(abstract_replication_strategy::ptr_type rs, token_metadata_ptr tmptr, replication_map replication_map, size_t replication_factor) {
+    auto erm = make_lw_shared<effective_replication_map>(std::move(rs), std::move(tmptr), std::move(replication_map), replication_factor);
+    co_await erm->build_sorted_replica_sets();
+    co_return erm;
+}
+
+future<> effective_replication_map::build_sorted_replica_sets() {
+    const auto& sorted_tokens = _tmptr->sorted_tokens();
+    _sorted_replica_sets.reserve(sorted_tokens.size());
+    for (const auto& t : sorted_tokens) {
+        _sorted_replica_sets.push_back(&_replication_map.at(t));
+        co_await coroutine::maybe_yield();
+    }
+}
+
+const inet_address_vector_replica_set& effective_replication_map::get_replica_set_for_token(const token& search_token) const {
+    const auto idx = _tmptr->first_token_index(search_token);
+    return *_sorted_replica_sets[idx];
 }
 
 future<replication_map> effective_replication_map::clone_endpoints_gently() const {
@@ -328,6 +346,7 @@ inet_address_vector_replica_set effective_replication_map::get_natural_endpoints
 }
 
 future<> effective_replication_map::clear_gently() noexcept {
+    _sorted_replica_sets = {};
     co_await utils::clear_gently(_replication_map);
     co_await utils::clear_gently(_tmptr);
 }
@@ -374,7 +393,7 @@ future<effective_replication_map_ptr> effective_replication_map_factory::create_
     if (ref_erm) {
         auto rf = ref_erm->get_replication_factor();
         auto local_replication_map = co_await ref_erm->clone_endpoints_gently();
-        new_erm = make_effective_replication_map(std::move(rs), std::move(tmptr), std::move(local_replication_map), rf);
+        new_erm = co_await make_effective_replication_map(std::move(rs), std::move(tmptr), std::move(local_replication_map), rf);
     } else {
         new_erm = co_await calculate_effective_replication_map(std::move(rs), std::move(tmptr));
     }
@@ -152,6 +152,12 @@ private:
     abstract_replication_strategy::ptr_type _rs;
     token_metadata_ptr _tmptr;
     replication_map _replication_map;
+    // The replica sets of _replication_map laid out in sorted-token order,
+    // so that the per-write natural-endpoint lookup is a binary search over
+    // the sorted tokens plus one vector index, with no token hashing.
+    // The entries point into _replication_map, whose nodes are stable for
+    // the lifetime of this object.
+    std::vector<const inet_address_vector_replica_set*> _sorted_replica_sets;
     size_t _replication_factor;
     std::optional<factory_key> _factory_key = std::nullopt;
     effective_replication_map_factory* _factory = nullptr;
@@ -185,6 +191,15 @@ public:
 
     future<replication_map> clone_endpoints_gently() const;
 
+    // Populate _sorted_replica_sets from _replication_map. Must be called
+    // once the replication map is final; make_effective_replication_map()
+    // takes care of it.
+    future<> build_sorted_replica_sets();
+
+    // Return the replica set owning the range the given token falls into.
+    // The reference is valid for as long as this object is alive.
+    const inet_address_vector_replica_set& get_replica_set_for_token(const token& search_token) const;
+
     inet_address_vector_replica_set get_natural_endpoints(const token& search_token) const;
     inet_address_vector_replica_set get_natural_endpoints_without_node_being_replaced(const token& search_token) const;
 
@@ -243,9 +258,7 @@ public:
 using effective_replication_map_ptr = lw_shared_ptr<const effective_replication_map>;
 using mutable_effective_replication_map_ptr = lw_shared_ptr<effective_replication_map>;
 
-inline mutable_effective_replication_map_ptr make_effective_replication_map(abstract_replication_strategy::ptr_type rs, token_metadata_ptr tmptr, replication_map replication_map, size_t replication_factor) {
-    return make_lw_shared<effective_replication_map>(std::move(rs), std::move(tmptr), std::move(replication_map), replication_factor);
-}
+future<mutable_effective_replication_map_ptr> make_effective_replication_map(abstract_replication_strategy::ptr_type rs, token_metadata_ptr tmptr, replication_map replication_map, size_t replication_factor);
 
 // Apply the replication strategy over the current configuration and the given token_metadata.
 future<mutable_effective_replication_map_ptr> calculate_effective_replication_map(abstract_replication_strategy::ptr_type rs, token_metadata_ptr tmptr);
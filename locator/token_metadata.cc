@@ -361,13 +361,23 @@ future<token_metadata_impl> token_metadata_impl::clone_only_token_map(bool clone
         return do_for_each(_token_to_endpoint_map, [&ret] (const auto& p) {
             ret._token_to_endpoint_map.emplace(p);
         }).then([this, &ret] {
-            ret._endpoint_to_host_id_map = _endpoint_to_host_id_map;
+            ret._endpoint_to_host_id_map.reserve(_endpoint_to_host_id_map.size());
+            return do_for_each(_endpoint_to_host_id_map, [&ret] (const auto& p) {
+                ret._endpoint_to_host_id_map.emplace(p);
+            });
         }).then([this, &ret] {
             ret._topology = _topology;
         }).then([this, &ret, clone_sorted_tokens] {
-            if (clone_sorted_tokens) {
-                ret._sorted_tokens = _sorted_tokens;
+            if (!clone_sorted_tokens) {
+                return make_ready_future<>();
             }
+            // The sorted token vector is O(nodes * vnodes) and each token owns
+            // heap-allocated key data, so copy it in chunks like the maps above.
+            ret._sorted_tokens.reserve(_sorted_tokens.size());
+            return do_for_each(_sorted_tokens, [&ret] (const token& t) {
+                ret._sorted_tokens.push_back(t);
+            });
+        }).then([&ret] {
             return make_ready_future<token_metadata_impl>(std::move(ret));
         });
     });
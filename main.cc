@@ -642,6 +642,7 @@ To start the scylla server proper, simply invoke as: scylla server (or just scyl
             smp::invoke_on_all([&cfg, background_reclaim_scheduling_group] {
                 logalloc::tracker::config st_cfg;
                 st_cfg.defragment_on_idle = cfg->defragment_memory_on_idle();
+                st_cfg.defragment_max_segment_occupancy = cfg->defragment_memory_max_occupancy();
                 st_cfg.abort_on_lsa_bad_alloc = cfg->abort_on_lsa_bad_alloc();
                 st_cfg.lsa_reclamation_step = cfg->lsa_reclamation_step();
                 st_cfg.background_reclaim_sched_group = background_reclaim_scheduling_group;
@@ -138,7 +138,7 @@ constexpr int32_t messaging_service::current_version;
 // Count of connection types that are not associated with any tenant
 const size_t PER_SHARD_CONNECTION_COUNT = 2;
 // Counts per tenant connection types
-const size_t PER_TENANT_CONNECTION_COUNT = 3;
+const size_t PER_TENANT_CONNECTION_COUNT = 4;
 
 bool operator==(const msg_addr& x, const msg_addr& y) noexcept {
     // Ignore cpu id for now since we do not really support shard to shard connections
@@ -489,7 +489,6 @@ static constexpr unsigned do_get_rpc_client_idx(messaging_verb verb) {
     case messaging_verb::MUTATION:
     case messaging_verb::READ_DATA:
     case messaging_verb::READ_MUTATION_DATA:
-    case messaging_verb::READ_DIGEST:
     case messaging_verb::DEFINITIONS_UPDATE:
     case messaging_verb::TRUNCATE:
     case messaging_verb::MIGRATION_REQUEST:
@@ -518,6 +517,19 @@ static constexpr unsigned do_get_rpc_client_idx(messaging_verb verb) {
         return 3;
     case messaging_verb::FORWARD_REQUEST:
         return 4;
+    // Small latency-critical messages get a dedicated connection so they
+    // are never stuck behind a multi-megabyte mutation or read response
+    // frame queued on the statement connection. Only verbs whose payloads
+    // are bounded in both directions belong here; digest read responses
+    // carry a hash instead of data, and paxos prune carries just a key and
+    // a ballot. Note that PAXOS_PREPARE does not qualify - its response may
+    // embed the last accepted proposal and most recent commit, which are
+    // full mutations. Verbs carrying mutations or result sets must stay on
+    // the statement connection or they would reintroduce the head-of-line
+    // blocking this lane exists to avoid.
+    case messaging_verb::READ_DIGEST:
+    case messaging_verb::PAXOS_PRUNE:
+        return 5;
     case messaging_verb::LAST:
         return -1; // should never happen
     }
@@ -574,6 +586,7 @@ messaging_service::initial_scheduling_info() const {
         sched_infos.push_back({ tenant.sched_group, "statement:" + tenant.name });
         sched_infos.push_back({ tenant.sched_group, "statement-ack:" + tenant.name });
         sched_infos.push_back({ tenant.sched_group, "forward:" + tenant.name });
+        sched_infos.push_back({ tenant.sched_group, "statement-urgent:" + tenant.name });
     }
 
     assert(sched_infos.size() == PER_SHARD_CONNECTION_COUNT +
@@ -713,11 +726,26 @@ shared_ptr<messaging_service::rpc_protocol_client_wrapper> messaging_service::ge
         return broadcast_address != laddr && snitch_ptr->get_rack(laddr) != my_rack;
     }();
 
-    auto must_compress = [&id, this] {
+    auto must_compress = [&id, idx, this] {
         if (_cfg.compress == compress_what::none) {
             return false;
         }
 
+        // The write-ack connection carries only tiny fixed-size responses
+        // (MUTATION_DONE/MUTATION_FAILED) at the highest message rate in the
+        // system. Per-message compression framing cannot win anything there
+        // and just burns CPU on both ends, so leave that connection plain.
+        // The same goes for the urgent connection, which is restricted to
+        // verbs with small bounded payloads. Each tenant has its own ack
+        // and urgent connections, hence the modulo.
+        if (idx >= PER_SHARD_CONNECTION_COUNT) {
+            auto tenant_offset = (idx - PER_SHARD_CONNECTION_COUNT) % PER_TENANT_CONNECTION_COUNT;
+            if (tenant_offset == do_get_rpc_client_idx(messaging_verb::MUTATION_DONE) - PER_SHARD_CONNECTION_COUNT
+                    || tenant_offset == do_get_rpc_client_idx(messaging_verb::READ_DIGEST) - PER_SHARD_CONNECTION_COUNT) {
+                return false;
+            }
+        }
+
         if (_cfg.compress == compress_what::dc) {
             auto& snitch_ptr = locator::i_endpoint_snitch::get_local_snitch_ptr();
             return snitch_ptr->get_datacenter(id.addr)
@@ -337,7 +337,7 @@ stop_iteration mutation_partition::apply_monotonically(const schema& s, mutation
                 ++app_stats.rows_dropped_by_tombstones;
                 i = _rows.erase(i);
                 if (tracker) {
-                    tracker->on_remove();
+                    tracker->on_remove(e);
                 }
                 del(&e);
             } else {
@@ -431,7 +431,7 @@ stop_iteration mutation_partition::apply_monotonically(const schema& s, mutation
                 if (src_e.dummy()) {
                     p_i = p._rows.erase(p_i);
                     if (tracker) {
-                        tracker->on_remove();
+                        tracker->on_remove(src_e);
                     }
                     del(&src_e);
                     insert = false;
@@ -452,7 +452,7 @@ stop_iteration mutation_partition::apply_monotonically(const schema& s, mutation
             // violating exception guarantees.
             src_e.set_continuous(false);
             if (tracker) {
-                tracker->on_remove();
+                tracker->on_remove(src_e);
                 // Newer evictable versions store complete rows
                 i->replace_with(std::move(src_e));
             } else {
@@ -2377,7 +2377,7 @@ stop_iteration mutation_partition::clear_gently(cache_tracker* tracker) noexcept
     auto end = _rows.end();
     while (i != end) {
         if (tracker) {
-            tracker->on_remove();
+            tracker->on_remove(*i);
         }
         i = _rows.erase_and_dispose(i, del);
 
@@ -2562,12 +2562,31 @@ stop_iteration mutation_cleaner_impl::merge_some(partition_snapshot& snp) noexce
 }
 
 stop_iteration mutation_cleaner_impl::merge_some() noexcept {
-    if (_worker_state->snapshots.empty()) {
+    auto& snapshots = _worker_state->snapshots;
+    if (snapshots.empty()) {
         return stop_iteration::yes;
     }
-    partition_snapshot& snp = _worker_state->snapshots.front();
+    // Spend the merging budget on the snapshot whose versions are traversed
+    // by reads the most, so that chains which actually slow down reads are
+    // shortened first. The scan is bounded so that a long queue doesn't make
+    // each selection quadratic; beyond the bound we fall back to queue order.
+    static constexpr unsigned max_selection_scan = 32;
+    auto best_prev = snapshots.before_begin();
+    {
+        auto prev = snapshots.before_begin();
+        auto it = snapshots.begin();
+        uint64_t best_score = it->reader_traversals();
+        unsigned scanned = 0;
+        for (; it != snapshots.end() && scanned < max_selection_scan; prev = it++, ++scanned) {
+            if (it->reader_traversals() > best_score) {
+                best_score = it->reader_traversals();
+                best_prev = prev;
+            }
+        }
+    }
+    partition_snapshot& snp = *std::next(best_prev);
     if (merge_some(snp) == stop_iteration::yes) {
-        _worker_state->snapshots.pop_front();
+        snapshots.erase_after(best_prev);
         lw_shared_ptr<partition_snapshot>::dispose(&snp);
     }
     return stop_iteration::no;
@@ -910,7 +910,10 @@ class rows_entry final : public evictable {
         // Marks a dummy entry which is after_all_clustered_rows() position.
         // Needed so that eviction, which can't use comparators, can check if it's dealing with it.
         bool _last_dummy : 1;
-        flags() : _before_ck(0), _after_ck(0), _continuous(true), _dummy(false), _last_dummy(false) { }
+        // Marks an entry which is kept off the eviction LRU so that memory
+        // pressure cannot evict it. See cache_tracker::pin().
+        bool _pinned : 1;
+        flags() : _before_ck(0), _after_ck(0), _continuous(true), _dummy(false), _last_dummy(false), _pinned(false) { }
     } _flags{};
 public:
     struct last_dummy_tag {};
@@ -967,6 +970,8 @@ public:
     void set_continuous(is_continuous value) { set_continuous(bool(value)); }
     is_dummy dummy() const { return is_dummy(_flags._dummy); }
     bool is_last_dummy() const { return _flags._last_dummy; }
+    bool pinned() const { return _flags._pinned; }
+    void set_pinned(bool value) { _flags._pinned = value; }
     void set_dummy(bool value) { _flags._dummy = value; }
     void set_dummy(is_dummy value) { _flags._dummy = bool(value); }
     void replace_with(rows_entry&& other) noexcept;
@@ -12,13 +12,18 @@
 #include "reader_concurrency_semaphore.hh"
 #include "readers/foreign.hh"
 #include "readers/queue.hh"
+#include "log.hh"
+#include <deque>
 #include <vector>
 #include <seastar/core/future-util.hh>
 #include <seastar/core/queue.hh>
 #include <seastar/core/smp.hh>
+#include <seastar/core/condition-variable.hh>
 
 namespace mutation_writer {
 
+static logging::logger mwlog("multishard_writer");
+
 class shard_writer {
 private:
     schema_ptr _s;
@@ -40,14 +45,43 @@ public:
 // the shard multishard_writer is on, it will forward the mutation_fragment to
 // the correct shard. Future returned by multishard_writer() becomes
 // ready when all the mutation_fragments are consumed.
+//
+// Fragments are not pushed to the per-shard queue readers directly, since a
+// push blocks whenever a queue is full and a single slow shard (compacting,
+// flushing) would stall distribution to all the others. Instead each shard
+// has a spill queue drained by its own flush fiber, and the producer only
+// waits when the total amount of spilled data exceeds a global read-ahead
+// budget -- so while a slow shard drains, the remaining shards keep being
+// fed from read-ahead.
 class multishard_writer {
 private:
+    // A single slow shard may use the entire budget; the point is to keep
+    // the other shards busy in the meantime without unbounded memory use.
+    static constexpr size_t spill_budget = 1 * 1024 * 1024;
+
+    struct shard_queue {
+        // Fragments read ahead of the shard's queue reader, in origin
+        // order, drained by the flush fiber tracked by flush_done.
+        std::deque<mutation_fragment_v2> spill;
+        future<> flush_done = make_ready_future<>();
+        bool flushing = false;
+        size_t spill_bytes = 0;
+        // Progress metrics, logged when the writer finishes.
+        uint64_t partitions = 0;
+        uint64_t fragments = 0;
+        size_t spill_bytes_peak = 0;
+    };
+
     schema_ptr _s;
     std::vector<foreign_ptr<std::unique_ptr<shard_writer>>> _shard_writers;
     std::vector<future<>> _pending_consumers;
     std::vector<std::optional<queue_reader_handle_v2>> _queue_reader_handles;
+    std::vector<shard_queue> _shard_queues;
     unsigned _current_shard = -1;
     uint64_t _consumed_partitions = 0;
+    size_t _spill_bytes = 0;
+    condition_variable _spill_cv;
+    std::exception_ptr _failed;
     flat_mutation_reader_v2 _producer;
     std::function<future<> (flat_mutation_reader_v2)> _consumer;
 private:
@@ -55,6 +89,9 @@ private:
         return _s->get_sharder().shard_of(mf.as_partition_start().key().token());
     }
     future<> make_shard_writer(unsigned shard);
+    void abort(std::exception_ptr ep) noexcept;
+    void start_flush(unsigned shard);
+    future<> flush_spill(unsigned shard);
     future<stop_iteration> handle_mutation_fragment(mutation_fragment_v2 mf);
     future<stop_iteration> handle_end_of_stream();
     future<> consume(unsigned shard);
@@ -100,6 +137,7 @@ multishard_writer::multishard_writer(
     std::function<future<> (flat_mutation_reader_v2)> consumer)
     : _s(std::move(s))
     , _queue_reader_handles(_s->get_sharder().shard_count())
+    , _shard_queues(_s->get_sharder().shard_count())
     , _producer(std::move(producer))
     , _consumer(std::move(consumer)) {
     _shard_writers.resize(_s->get_sharder().shard_count());
@@ -122,6 +160,53 @@ future<> multishard_writer::make_shard_writer(unsigned shard) {
     });
 }
 
+void multishard_writer::abort(std::exception_ptr ep) noexcept {
+    if (!_failed) {
+        _failed = ep;
+    }
+    for (auto& q : _queue_reader_handles) {
+        if (q) {
+            q->abort(ep);
+        }
+    }
+    // Wake the producer if it is waiting for the read-ahead budget.
+    _spill_cv.broadcast();
+}
+
+void multishard_writer::start_flush(unsigned shard) {
+    auto& q = _shard_queues[shard];
+    if (q.flushing) {
+        return;
+    }
+    q.flushing = true;
+    q.flush_done = q.flush_done.then([this, shard] {
+        return flush_spill(shard);
+    }).handle_exception([this] (std::exception_ptr ep) {
+        abort(std::move(ep));
+    });
+}
+
+future<> multishard_writer::flush_spill(unsigned shard) {
+    auto& q = _shard_queues[shard];
+    return repeat([this, shard, &q] {
+        if (q.spill.empty()) {
+            q.flushing = false;
+            return make_ready_future<stop_iteration>(stop_iteration::yes);
+        }
+        auto mf = std::move(q.spill.front());
+        q.spill.pop_front();
+        auto size = mf.memory_usage();
+        return _queue_reader_handles[shard]->push(std::move(mf)).then([this, &q, size] {
+            q.spill_bytes -= size;
+            _spill_bytes -= size;
+            if (_spill_bytes < spill_budget) {
+                _spill_cv.broadcast();
+            }
+            return stop_iteration::no;
+        });
+    });
+}
+
 future<stop_iteration> multishard_writer::handle_mutation_fragment(mutation_fragment_v2 mf) {
     auto f = make_ready_future<>();
     if (mf.is_partition_start()) {
@@ -135,7 +220,30 @@ future<stop_iteration> multishard_writer::handle_mutation_fragment(mutation_frag
     }
     return f.then([this, mf = std::move(mf)] () mutable {
         assert(_current_shard != -1u);
-        return _queue_reader_handles[_current_shard]->push(std::move(mf));
+        auto& q = _shard_queues[_current_shard];
+        q.fragments++;
+        if (mf.is_partition_start()) {
+            q.partitions++;
+        }
+        auto size = mf.memory_usage();
+        q.spill_bytes += size;
+        q.spill_bytes_peak = std::max(q.spill_bytes_peak, q.spill_bytes);
+        _spill_bytes += size;
+        q.spill.emplace_back(std::move(mf));
+        start_flush(_current_shard);
+        if (_spill_bytes < spill_budget) {
+            return make_ready_future<>();
+        }
+        // Out of read-ahead budget; wait until the flush fibers drain some
+        // of it before reading more from the producer.
+        return _spill_cv.wait([this] {
+            return _spill_bytes < spill_budget || _failed;
+        }).then([this] {
+            if (_failed) {
+                return make_exception_future<>(_failed);
+            }
+            return make_ready_future<>();
+        });
     }).then([] {
         return stop_iteration::no;
     });
@@ -143,10 +251,17 @@ future<stop_iteration> multishard_writer::handle_mutation_fragment(mutation_frag
 
 future<stop_iteration> multishard_writer::handle_end_of_stream() {
     return parallel_for_each(boost::irange(0u, _s->get_sharder().shard_count()), [this] (unsigned shard) {
-        if (_queue_reader_handles[shard]) {
-            _queue_reader_handles[shard]->push_end_of_stream();
+        if (!_queue_reader_handles[shard]) {
+            return make_ready_future<>();
         }
-        return make_ready_future<>();
+        // End the stream only once the shard's spill has fully drained.
+        auto& q = _shard_queues[shard];
+        q.flush_done = q.flush_done.then([this, shard] {
+            if (!_failed) {
+                _queue_reader_handles[shard]->push_end_of_stream();
+            }
+        });
+        return std::exchange(q.flush_done, make_ready_future<>());
     }).then([] {
         return stop_iteration::yes;
     });
@@ -156,11 +271,7 @@ future<> multishard_writer::consume(unsigned shard) {
     return smp::submit_to(shard, [writer = _shard_writers[shard].get()] () mutable {
         return writer->consume();
     }).handle_exception([this] (std::exception_ptr ep) {
-        for (auto& q : _queue_reader_handles) {
-            if (q) {
-                q->abort(ep);
-            }
-        }
+        abort(ep);
         return make_exception_future<>(std::move(ep));
     });
 }
@@ -179,11 +290,7 @@ future<> multishard_writer::distribute_mutation_fragments() {
             }
         });
     }).handle_exception([this] (std::exception_ptr ep) {
-        for (auto& q : _queue_reader_handles) {
-            if (q) {
-                q->abort(ep);
-            }
-        }
+        abort(ep);
         return make_exception_future<>(std::move(ep));
     });
 }
@@ -192,6 +299,15 @@ future<uint64_t> multishard_writer::operator()() {
     return distribute_mutation_fragments().finally([this] {
         return wait_pending_consumers();
     }).then([this] {
+        if (mwlog.is_enabled(logging::log_level::debug)) {
+            for (unsigned shard = 0; shard < _shard_queues.size(); shard++) {
+                const auto& q = _shard_queues[shard];
+                if (q.fragments) {
+                    mwlog.debug("wrote {} partitions ({} fragments) to shard {}, peak read-ahead {} bytes",
+                            q.partitions, q.fragments, shard, q.spill_bytes_peak);
+                }
+            }
+        }
         return _consumed_partitions;
     });
 }
@@ -209,6 +325,11 @@ future<uint64_t> distribute_reader_and_consume_on_shards(schema_ptr s,
 
 future<> multishard_writer::close() noexcept {
     return _producer.close().then([this] {
+        // Wait for the flush fibers left running if distribution failed.
+        return parallel_for_each(_shard_queues, [] (shard_queue& q) {
+            return std::exchange(q.flush_done, make_ready_future<>());
+        });
+    }).then([this] {
         return parallel_for_each(boost::irange(size_t(0), _shard_writers.size()), [this] (auto shard) {
             if (auto w = std::move(_shard_writers[shard])) {
                 return smp::submit_to(shard, [w = std::move(w)] () mutable {
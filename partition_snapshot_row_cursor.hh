@@ -214,6 +214,13 @@ class partition_snapshot_row_cursor final {
         bool first = true;
         for (auto&& v : _snp.versions()) {
             unique_owner = unique_owner && (first || !v.is_referenced());
+            if (!first && v.is_referenced()) {
+                // The older version is owned by a different snapshot, possibly one
+                // already queued for background merging. Record that reads through
+                // this snapshot traverse it so that mutation_cleaner merges the
+                // chains which slow down reads first.
+                partition_snapshot::referer_of(v).on_reader_traversal();
+            }
             auto rows = v.partition().clustered_rows();
             auto pos = rows.lower_bound(lower_bound, cmp);
             if (first) {
@@ -336,6 +343,73 @@ public:
         _change_mark = _snp.get_change_mark();
     }
 
+    // Number of forward steps to try from the current iterators before
+    // falling back to a root-descent lower_bound() in a version's tree.
+    // Keeps advancing over nearby disjoint ranges (e.g. multi-range IN
+    // slices) linear in the distance instead of logarithmic in the
+    // partition size.
+    static constexpr int forward_scan_limit = 8;
+
+    // Attempts to reposition the iterators at the first entries with
+    // positions >= pos by stepping them forward from where they are,
+    // instead of descending from the tree roots like prepare_heap() does.
+    // pos is in the query schema domain.
+    // Returns false iff the fast path does not apply; the cursor state is
+    // unchanged in that case. Call only when the iterators are valid.
+    bool try_advance_from_current(position_in_partition_view pos) {
+        if (_reversed || !at_a_row()) {
+            return false;
+        }
+        // Query and table domains coincide for forward cursors, so pos and
+        // _position are directly comparable with the entries.
+        rows_entry::tri_compare cmp(*_snp.schema());
+        if (cmp(_position, pos) >= 0) {
+            return false;
+        }
+        memory::on_alloc_point();
+        // When the latest version's iterator is parked ahead of the cursor,
+        // entries may have been inserted behind it (see the insert hints in
+        // cache_flat_mutation_reader), so it cannot be stepped forward and
+        // needs a fresh lookup - the same reason maybe_refresh() re-seeks
+        // the latest version. Iterators at the cursor and iterators of the
+        // non-latest versions cannot have entries slipped in ahead of them.
+        const bool latest_at_cursor = is_in_latest_version();
+        // No allocations nor throwing comparisons below, so the iterators
+        // cannot be left half-advanced.
+        auto advance_one = [&] (position_in_version& v) {
+            if (v.version_no == 0 && !latest_at_cursor) {
+                v.it = v.rows.lower_bound(pos, cmp);
+            } else {
+                int steps = forward_scan_limit;
+                while (v.it && cmp(v.it->position(), pos) < 0) {
+                    if (steps-- == 0) {
+                        v.it = v.rows.lower_bound(pos, cmp);
+                        break;
+                    }
+                    ++v.it;
+                }
+            }
+            if (v.version_no == 0) {
+                _latest_it = v.it;
+            }
+            if (v.it) {
+                v.continuous = v.it->continuous();
+                _heap.push_back(std::move(v));
+            }
+        };
+        auto current = std::exchange(_current_row, {});
+        auto heap = std::exchange(_heap, {});
+        for (auto&& v : current) {
+            advance_one(v);
+        }
+        for (auto&& v : heap) {
+            advance_one(v);
+        }
+        version_heap_less_compare heap_less(*this);
+        boost::range::make_heap(_heap, heap_less);
+        return true;
+    }
+
     // Advances cursor to the first entry with position >= pos, if such entry exists.
     // If no such entry exists, the cursor is positioned at an extreme position in the direction of
     // the cursor (min for reversed cursor, max for forward cursor) and not pointing at a row
@@ -344,6 +418,9 @@ public:
     // continuous() is always valid after the call, even if not pointing at a row.
     // Returns true iff the cursor is pointing at a row after the call.
     bool maybe_advance_to(position_in_partition_view pos) {
+        if (iterators_valid() && try_advance_from_current(pos)) {
+            return recreate_current_row();
+        }
         prepare_heap(pos);
         return recreate_current_row();
     }
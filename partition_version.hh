@@ -296,6 +296,10 @@ private:
     cache_tracker* _tracker;
     boost::intrusive::slist_member_hook<> _cleaner_hook;
     std::optional<std::pair<version_number_type, apply_resume>> _version_merging_state;
+    // Number of times readers had to descend into this snapshot's versions
+    // while reading through a newer snapshot. Used by mutation_cleaner to
+    // prioritize merging of version chains which reads actually traverse.
+    uint64_t _reader_traversals = 0;
     bool _locked = false;
     friend class partition_entry;
     friend class mutation_cleaner_impl;
@@ -338,10 +342,23 @@ public:
 
     // Returns a reference to the partition_snapshot which is attached to given non-latest partition version.
     // Assumes !v.is_referenced_from_entry() && v.is_referenced().
+    static partition_snapshot& referer_of(partition_version& v) {
+        return container_of(v._backref);
+    }
     static const partition_snapshot& referer_of(const partition_version& v) {
         return container_of(v._backref);
     }
 
+    // Called by readers whenever positioning in the snapshot's version chain
+    // required looking at this snapshot's version. See _reader_traversals.
+    void on_reader_traversal() noexcept {
+        ++_reader_traversals;
+    }
+
+    uint64_t reader_traversals() const noexcept {
+        return _reader_traversals;
+    }
+
     // If possible, merges the version pointed to by this snapshot with
     // adjacent partition versions. Leaves the snapshot in an unspecified state.
     // Can be retried if previous merge attempt has failed.
@@ -338,6 +338,19 @@ std::optional<Querier> querier_cache::lookup_querier(
 
     tracing::trace(trace_state, "Dropping querier because {}", cannot_use_reason(can_be_used));
     ++stats.drops;
+    switch (can_be_used) {
+        case can_use::no_schema_version_mismatch:
+            ++stats.drops_due_to_schema_version_mismatch;
+            break;
+        case can_use::no_ring_pos_mismatch:
+            ++stats.drops_due_to_ring_pos_mismatch;
+            break;
+        case can_use::no_clustering_pos_mismatch:
+            ++stats.drops_due_to_clustering_pos_mismatch;
+            break;
+        case can_use::yes:
+            break;
+    }
 
     // Close and drop the querier in the background.
     // It is safe to do so, since _closing_gate is closed and
@@ -338,6 +338,10 @@ public:
         // The subset of lookups that hit but the looked up querier had to be
         // dropped due to position mismatch.
         uint64_t drops = 0;
+        // Breakdown of `drops` by the reason the querier couldn't be reused.
+        uint64_t drops_due_to_schema_version_mismatch = 0;
+        uint64_t drops_due_to_ring_pos_mismatch = 0;
+        uint64_t drops_due_to_clustering_pos_mismatch = 0;
         // The number of queriers evicted due to their TTL expiring.
         uint64_t time_based_evictions = 0;
         // The number of queriers evicted to free up resources to be able to
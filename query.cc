@@ -349,6 +349,14 @@ foreign_ptr<lw_shared_ptr<query::result>> result_merger::get() {
     }
 
     bytes_ostream w;
+    // The merged result is about as big as the partial results combined
+    // (smaller when the row/partition limits cut it short), so start with
+    // appropriately sized chunks instead of growing from the default size.
+    size_t merged_size_hint = 0;
+    for (auto&& r : _partial) {
+        merged_size_hint += r->buf().size();
+    }
+    w.reserve(merged_size_hint);
     auto partitions = ser::writer_of_query_result<bytes_ostream>(w).start_partitions();
     uint64_t row_count = 0;
     short_read is_short_read;
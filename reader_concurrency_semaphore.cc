@@ -75,12 +75,14 @@ class reader_permit::impl
     reader_resources _base_resources;
     bool _base_resources_consumed = false;
     reader_resources _resources;
+    size_t _peak_memory = 0;
     reader_permit::state _state = reader_permit::state::active_unused;
     uint64_t _used_branches = 0;
     bool _marked_as_used = false;
     uint64_t _blocked_branches = 0;
     bool _marked_as_blocked = false;
     db::timeout_clock::time_point _timeout;
+    lowres_clock::time_point _enqueued_at;
     query::max_result_size _max_result_size{query::result_memory_limiter::unlimited_result_size};
 
 private:
@@ -189,11 +191,15 @@ public:
     }
 
     void on_waiting() {
+        _enqueued_at = lowres_clock::now();
         on_permit_inactive(reader_permit::state::waiting);
     }
 
     void on_admission() {
         assert(_state != reader_permit::state::active_blocked);
+        if (_state == reader_permit::state::waiting) {
+            _semaphore.get_stats().estimated_admission_wait.add(lowres_clock::now() - _enqueued_at);
+        }
         on_permit_active();
         consume(_base_resources);
         _base_resources_consumed = true;
@@ -220,6 +226,7 @@ public:
 
     void consume(reader_resources res) {
         _resources += res;
+        _peak_memory = std::max(_peak_memory, size_t(_resources.memory));
         _semaphore.consume(res);
     }
 
@@ -236,6 +243,10 @@ public:
         return _base_resources;
     }
 
+    size_t peak_memory() const {
+        return _peak_memory;
+    }
+
     void release_base_resources() noexcept {
         if (_base_resources_consumed) {
             _resources -= _base_resources;
@@ -815,6 +826,10 @@ bool reader_concurrency_semaphore::has_available_units(const resources& r) const
     return (bool(_resources) && _resources >= r) || _resources.count == _initial_resources.count;
 }
 
+reader_concurrency_semaphore::resources reader_concurrency_semaphore::predicted_base_resources(const resources& base) const noexcept {
+    return {base.count, base.memory + ssize_t(_stats.read_excess_memory_ewma)};
+}
+
 bool reader_concurrency_semaphore::all_used_permits_are_stalled() const {
     return _stats.used_permits == _stats.blocked_permits;
 }
@@ -859,7 +874,7 @@ future<> reader_concurrency_semaphore::do_wait_admission(reader_permit permit, r
         return enqueue_waiter(std::move(permit), std::move(func));
     }
 
-    if (!has_available_units(permit.base_resources())) {
+    if (!has_available_units(predicted_base_resources(permit.base_resources()))) {
         auto fut = enqueue_waiter(std::move(permit), std::move(func));
         if (!_inactive_reads.empty()) {
             evict_readers_in_background();
@@ -880,7 +895,7 @@ future<> reader_concurrency_semaphore::do_wait_admission(reader_permit permit, r
 }
 
 void reader_concurrency_semaphore::maybe_admit_waiters() noexcept {
-    while (!_wait_list.empty() && _ready_list.empty() && has_available_units(_wait_list.front().permit.base_resources()) && all_used_permits_are_stalled()) {
+    while (!_wait_list.empty() && _ready_list.empty() && has_available_units(predicted_base_resources(_wait_list.front().permit.base_resources())) && all_used_permits_are_stalled()) {
         auto& x = _wait_list.front();
         try {
             x.permit.on_admission();
@@ -905,6 +920,15 @@ void reader_concurrency_semaphore::on_permit_created(reader_permit::impl& permit
 }
 
 void reader_concurrency_semaphore::on_permit_destroyed(reader_permit::impl& permit) noexcept {
+    if (const auto base = permit.base_resources()) {
+        // Fold the read's peak memory consumption beyond its base into the
+        // admission estimate, with a decay factor of 1/8. Tracking-only
+        // permits have empty base resources and are excluded — they don't
+        // go through admission.
+        const auto excess = permit.peak_memory() > size_t(base.memory) ? permit.peak_memory() - size_t(base.memory) : 0;
+        auto& ewma = _stats.read_excess_memory_ewma;
+        ewma = ewma - (ewma >> 3) + (excess >> 3);
+    }
     permit.unlink();
     _permit_gate.leave();
     --_stats.current_permits;
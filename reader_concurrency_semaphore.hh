@@ -15,6 +15,7 @@
 #include <seastar/core/expiring_fifo.hh>
 #include "reader_permit.hh"
 #include "readers/flat_mutation_reader_v2.hh"
+#include "utils/estimated_histogram.hh"
 
 namespace bi = boost::intrusive;
 
@@ -75,6 +76,9 @@ public:
         uint64_t reads_admitted = 0;
         // Total number of reads enqueued to wait for admission.
         uint64_t reads_enqueued = 0;
+        // How long enqueued reads waited before being admitted.
+        // Reads admitted on the fast path, without queueing, are not recorded.
+        utils::time_estimated_histogram estimated_admission_wait;
         // Total number of permits created so far.
         uint64_t total_permits = 0;
         // Current number of permits.
@@ -83,6 +87,11 @@ public:
         uint64_t used_permits = 0;
         // Current number of blocked permits.
         uint64_t blocked_permits = 0;
+        // Exponential moving average of how much memory reads consumed at
+        // their peak beyond their base resources, fed when their permit is
+        // destroyed. Used to predict the real cost of waiting reads on
+        // admission.
+        size_t read_excess_memory_ewma = 0;
     };
 
     using permit_list_type = bi::list<
@@ -192,6 +201,12 @@ private:
 
     bool has_available_units(const resources& r) const;
 
+    // The resources to admit the permit against: the base resources plus
+    // the typical peak memory consumed by past reads beyond their base,
+    // so that the admission decision reflects what the read is expected
+    // to actually consume rather than just its initial memory hint.
+    resources predicted_base_resources(const resources& base) const noexcept;
+
     bool all_used_permits_are_stalled() const;
 
     [[nodiscard]] std::exception_ptr check_queue_size(std::string_view queue_name);
@@ -271,6 +271,9 @@ public:
     reader_concurrency_semaphore::inactive_read_handle inactive_read_handle() && {
         return std::move(_irh);
     }
+    void set_max_buffer_size(size_t size) {
+        max_buffer_size_in_bytes = size;
+    }
     void pause() {
         if (_reader) {
             do_pause(std::move(*_reader));
@@ -564,6 +567,10 @@ future<> evictable_reader_v2::fill_buffer() {
         co_return;
     }
     _reader = co_await resume_or_create_reader();
+    // We fill from the underlying reader's buffer, so it is the one that has
+    // to honour our buffer size, which shard_reader_v2 adjusts as the read
+    // progresses.
+    _reader->set_max_buffer_size(max_buffer_size_in_bytes);
 
     if (_reader_recreated) {
         // Recreating the reader breaks snapshot isolation and creates all sorts
@@ -710,6 +717,14 @@ private:
     const mutation_reader::forwarding _fwd_mr;
     std::optional<future<>> _read_ahead;
     foreign_ptr<std::unique_ptr<evictable_reader_v2>> _reader;
+    // The remote reader's buffer size, i.e. the amount of data transferred
+    // per cross-shard hop. Starts at the default so limit-bound queries
+    // move little data, and doubles on every fill that doesn't exhaust the
+    // stream — a consumer that keeps draining the buffer is a scan and
+    // amortizes the smp round-trips over ever larger batches.
+    size_t _buffer_fill_size = default_max_buffer_size_in_bytes();
+
+    static constexpr size_t max_buffer_fill_size = 128 * 1024;
 
 private:
     future<> do_fill_buffer();
@@ -824,6 +839,7 @@ future<> shard_reader_v2::do_fill_buffer() {
             std::exception_ptr ex;
             try {
                 tracing::trace(_trace_state, "Creating shard reader on shard: {}", this_shard_id());
+                rreader->set_max_buffer_size(_buffer_fill_size);
                 reader_permit::used_guard ug{rreader->permit()};
                 co_await rreader->fill_buffer();
                 auto res = remote_fill_buffer_result_v2(rreader->detach_buffer(), rreader->is_end_of_stream());
@@ -839,6 +855,7 @@ future<> shard_reader_v2::do_fill_buffer() {
         });
     } else {
         fill_buf_fut = smp::submit_to(_shard, [this] () mutable {
+            _reader->set_max_buffer_size(_buffer_fill_size);
             reader_permit::used_guard ug{_reader->permit()};
             return _reader->fill_buffer().then([this, ug = std::move(ug)] {
                 return remote_fill_buffer_result_v2(_reader->detach_buffer(), _reader->is_end_of_stream());
@@ -848,6 +865,11 @@ future<> shard_reader_v2::do_fill_buffer() {
 
     auto res = co_await(std::move(fill_buf_fut));
     _end_of_stream = res.end_of_stream;
+    if (!res.end_of_stream) {
+        // Every fill means the consumer drained the previous buffer, so
+        // ramp up the transfer size for the next hop.
+        _buffer_fill_size = std::min(_buffer_fill_size * 2, max_buffer_fill_size);
+    }
     reserve_additional(res.buffer->size());
     for (const auto& mf : *res.buffer) {
         push_mutation_fragment(mutation_fragment_v2(*_schema, _permit, mf));
@@ -84,11 +84,12 @@ future<redis_server::result> redis_server::connection::process_request_internal(
 
 void redis_server::connection::write_reply(const redis_exception& e)
 {
+    ++_unflushed_replies;
     _ready_to_respond = _ready_to_respond.then([this, exception_message = e.what_message()] () mutable {
         return redis_message::exception(exception_message).then([this] (auto&& result) {
             auto m = result.message();
-            return _write_buf.write(std::move(*m)).then([this] {
-                return _write_buf.flush();
+            return _write_buf.write(std::move(*m)).finally([this] {
+                return maybe_flush();
             });
         });
     });
@@ -96,10 +97,11 @@ void redis_server::connection::write_reply(const redis_exception& e)
 
 void redis_server::connection::write_reply(redis_server::result result)
 {
+    ++_unflushed_replies;
     _ready_to_respond = _ready_to_respond.then([this, result = std::move(result)] () mutable {
         auto m = result.make_message();
-        return _write_buf.write(std::move(*m)).then([this] {
-            return _write_buf.flush();
+        return _write_buf.write(std::move(*m)).finally([this] {
+            return maybe_flush();
         });
     });
 }
@@ -80,6 +80,9 @@ private:
         socket_address _server_addr;
         redis_protocol_parser _parser;
         redis::redis_options _options;
+        // Number of replies queued on _ready_to_respond whose write hasn't
+        // completed yet; the one that drops it to zero flushes for the burst.
+        uint64_t _unflushed_replies = 0;
 
         using execution_stage_type = inheriting_concrete_execution_stage<
                 future<redis_server::result>,
@@ -100,6 +103,14 @@ private:
         const ::timeout_config& timeout_config() { return _server.timeout_config(); }
         future<result> process_request_one(redis::request&& request, redis::redis_options&, service_permit permit);
         future<result> process_request_internal();
+        // Replies are written back-to-back on _ready_to_respond; only the
+        // last one of a pipelined burst issues the actual flush.
+        future<> maybe_flush() {
+            if (--_unflushed_replies == 0) {
+                return _write_buf.flush();
+            }
+            return make_ready_future<>();
+        }
     };
 
     virtual shared_ptr<generic_server::connection> make_connection(socket_address server_addr, connected_socket&& fd, socket_address addr) override;
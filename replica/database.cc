@@ -47,6 +47,7 @@
 #include "utils/fb_utilities.hh"
 #include "utils/stall_free.hh"
 #include "utils/fmt-compat.hh"
+#include "utils/histogram_metrics_helper.hh"
 
 #include "db/timeout_clock.hh"
 #include "db/large_data_handler.hh"
@@ -84,7 +85,7 @@ make_flush_controller(const db::config& cfg, backlog_controller::scheduling_grou
     if (cfg.memtable_flush_static_shares() > 0) {
         return flush_controller(sg, cfg.memtable_flush_static_shares());
     }
-    return flush_controller(sg, 50ms, cfg.virtual_dirty_soft_limit(), std::move(fn));
+    return flush_controller(sg, 50ms, cfg.virtual_dirty_soft_limit(), std::move(fn), cfg.memtable_flush_derivative_gain());
 }
 
 inline compaction_manager::config make_compaction_manager_config(const db::config& cfg, database_config& dbcfg) {
@@ -373,6 +374,8 @@ database::database(const db::config& cfg, database_config dbcfg, service::migrat
 {
     assert(dbcfg.available_memory != 0); // Detect misconfigured unit tests, see #7544
 
+    _querier_cache.set_entry_ttl(std::chrono::seconds(_cfg.querier_cache_entry_ttl_in_seconds()));
+
     local_schema_registry().init(*this); // TODO: we're never unbound.
     setup_metrics();
 
@@ -401,6 +404,13 @@ const data_dictionary::user_types_storage& database::user_types() const noexcept
 void backlog_controller::adjust() {
     auto backlog = _current_backlog();
 
+    if (_derivative_gain != 0.0f) {
+        auto delta = backlog - std::exchange(_last_backlog, backlog);
+        if (delta > 0.0f) {
+            backlog = std::min(backlog + _derivative_gain * delta, _control_points.back().input);
+        }
+    }
+
     if (backlog >= _control_points.back().input) {
         update_controller(_control_points.back().output);
         return;
@@ -570,6 +580,17 @@ database::setup_metrics() {
         sm::make_counter("querier_cache_drops", _querier_cache.get_stats().drops,
                        sm::description("Counts querier cache lookups that found a cached querier but had to drop it due to position mismatch")),
 
+        sm::make_counter("querier_cache_drops_due_to_schema_version_mismatch", _querier_cache.get_stats().drops_due_to_schema_version_mismatch,
+                       sm::description("The subset of querier_cache_drops caused by the page being requested with a different schema version.")),
+
+        sm::make_counter("querier_cache_drops_due_to_ring_pos_mismatch", _querier_cache.get_stats().drops_due_to_ring_pos_mismatch,
+                       sm::description("The subset of querier_cache_drops caused by the page starting from a different partition position than the "
+                                       "cached querier stopped at, typically the result of a driver retrying or re-requesting a page.")),
+
+        sm::make_counter("querier_cache_drops_due_to_clustering_pos_mismatch", _querier_cache.get_stats().drops_due_to_clustering_pos_mismatch,
+                       sm::description("The subset of querier_cache_drops caused by the page starting from a different clustering position than the "
+                                       "cached querier stopped at, typically the result of a driver retrying or re-requesting a page.")),
+
         sm::make_counter("querier_cache_time_based_evictions", _querier_cache.get_stats().time_based_evictions,
                        sm::description("Counts querier cache entries that timed out and were evicted.")),
 
@@ -602,6 +623,11 @@ database::setup_metrics() {
                        sm::description("Holds the number of currently queued read operations."),
                        {user_label_instance}),
 
+        sm::make_histogram("reads_admission_wait", [this] { return to_metrics_histogram(_read_concurrency_sem.get_stats().estimated_admission_wait); },
+                       sm::description("How long queued reads waited until they were admitted. "
+                                       "Correlate with the foreground read latency to tell whether slow reads spend their time waiting in the queue or doing actual work."),
+                       {user_label_instance}),
+
         sm::make_gauge("paused_reads", _read_concurrency_sem.get_stats().inactive_reads,
                        sm::description("The number of currently active reads that are temporarily paused."),
                        {user_label_instance}),
@@ -632,6 +658,10 @@ database::setup_metrics() {
                        sm::description("Holds the number of currently queued read operations on behalf of streaming."),
                        {streaming_label_instance}),
 
+        sm::make_histogram("reads_admission_wait", [this] { return to_metrics_histogram(_streaming_concurrency_sem.get_stats().estimated_admission_wait); },
+                       sm::description("How long queued streaming reads waited until they were admitted."),
+                       {streaming_label_instance}),
+
         sm::make_gauge("paused_reads", _streaming_concurrency_sem.get_stats().inactive_reads,
                        sm::description("The number of currently ongoing streaming reads that are temporarily paused."),
                        {streaming_label_instance}),
@@ -661,6 +691,10 @@ database::setup_metrics() {
                        sm::description("Holds the number of currently queued read operations from \"system\" keyspace tables."),
                        {system_label_instance}),
 
+        sm::make_histogram("reads_admission_wait", [this] { return to_metrics_histogram(_system_read_concurrency_sem.get_stats().estimated_admission_wait); },
+                       sm::description("How long queued reads from \"system\" keyspace tables waited until they were admitted."),
+                       {system_label_instance}),
+
         sm::make_gauge("paused_reads", _system_read_concurrency_sem.get_stats().inactive_reads,
                        sm::description("The number of currently ongoing system reads that are temporarily paused."),
                        {system_label_instance}),
@@ -1139,6 +1173,7 @@ keyspace::make_column_family_config(const schema& s, const database& db) const {
     cfg.view_update_concurrency_semaphore = _config.view_update_concurrency_semaphore;
     cfg.view_update_concurrency_semaphore_limit = _config.view_update_concurrency_semaphore_limit;
     cfg.data_listeners = &db.data_listeners();
+    cfg.live_large_partition_threshold_bytes = uint64_t(db_config.compaction_large_partition_warning_threshold_mb()) << 20;
 
     return cfg;
 }
@@ -42,6 +42,7 @@
 #include "row_cache.hh"
 #include "compaction/compaction_strategy.hh"
 #include "utils/estimated_histogram.hh"
+#include "utils/hot_partition_sketch.hh"
 #include "sstables/sstable_set.hh"
 #include <seastar/core/metrics_registration.hh>
 #include "tracing/trace_state.hh"
@@ -350,6 +351,10 @@ struct table_stats {
     utils::timed_rate_moving_average_and_histogram tombstone_scanned;
     utils::timed_rate_moving_average_and_histogram live_scanned;
     utils::estimated_histogram estimated_coordinator_read;
+    /** Probabilistic per-partition write frequency tracker, fed by memtable writes. */
+    utils::hot_partition_sketch hot_partition_writes;
+    /** Estimated bytes recently written per partition, for live large partition detection. */
+    utils::hot_partition_sketch hot_partition_write_bytes{1024, std::chrono::minutes(10)};
 };
 
 class table : public enable_lw_shared_from_this<table> {
@@ -384,6 +389,10 @@ public:
         utils::updateable_value<bool> enable_optimized_reversed_reads{true};
         // Can be updated by a schema change:
         bool enable_optimized_twcs_queries{true};
+        // Partitions which receive more than this many bytes of writes within
+        // the write volume sketch's decay period are recorded as live large
+        // partitions.
+        uint64_t live_large_partition_threshold_bytes = std::numeric_limits<uint64_t>::max();
     };
     struct no_commitlog {};
 
@@ -395,6 +404,13 @@ public:
         cache_temperature rate;
         lowres_clock::time_point last_updated;
     };
+    // A partition whose recent write volume crossed the large partition
+    // threshold, detected on the write path rather than at sstable write time.
+    struct live_large_partition {
+        dht::decorated_key key;
+        uint64_t estimated_write_bytes;
+        db_clock::time_point detected_at;
+    };
 private:
     schema_ptr _schema;
     config _config;
@@ -404,6 +420,13 @@ private:
 
     uint64_t _failed_counter_applies_to_memtable = 0;
 
+    // Bounded registry of recently detected large partitions, exposed through
+    // the system.live_large_partitions virtual table.
+    static constexpr size_t max_live_large_partitions = 16;
+    std::vector<live_large_partition> _live_large_partitions;
+
+    void record_write_size(const frozen_mutation& m, const schema& s);
+
     template<typename... Args>
     void do_apply(db::rp_handle&&, Args&&... args);
 
@@ -552,6 +575,10 @@ private:
     lw_shared_ptr<sstables::sstable_set>
     do_add_sstable(lw_shared_ptr<sstables::sstable_set> sstables, sstables::shared_sstable sstable,
         enable_backlog_tracker backlog_tracker);
+    // Adds new sstable to the given set in place. The caller is responsible for
+    // not mutating a set which in-progress reads may still be using.
+    void do_add_sstable(sstables::sstable_set& sstables, sstables::shared_sstable sstable,
+        enable_backlog_tracker backlog_tracker);
     void add_sstable(sstables::shared_sstable sstable);
     void add_maintenance_sstable(sstables::shared_sstable sst);
     static void add_sstable_to_backlog_tracker(compaction_backlog_tracker& tracker, sstables::shared_sstable sstable);
@@ -774,6 +801,12 @@ public:
     future<> apply(const frozen_mutation& m, schema_ptr m_schema, db::rp_handle&& h, db::timeout_clock::time_point tmo);
     future<> apply(const mutation& m, db::rp_handle&& h, db::timeout_clock::time_point tmo);
 
+    // Partitions whose recent write volume crossed the large partition
+    // threshold. The order of the entries is unspecified.
+    const std::vector<live_large_partition>& live_large_partitions() const {
+        return _live_large_partitions;
+    }
+
     // Returns at most "cmd.limit" rows
     // The saved_querier parameter is an input-output parameter which contains
     // the saved querier from the previous page (if there was one) and after
@@ -217,6 +217,8 @@ partition_entry&
 memtable::find_or_create_partition(const dht::decorated_key& key) {
     assert(!reclaiming_enabled());
 
+    _table_stats.hot_partition_writes.record(key.token().raw());
+
     // call lower_bound so we have a hint for the insert, just in case.
     partitions_type::bound_hint hint;
     auto i = partitions.lower_bound(key, dht::ring_position_comparator(*_schema), hint);
@@ -386,15 +386,13 @@ void table::backlog_tracker_adjust_charges(const std::vector<sstables::shared_ss
     tracker.replace_sstables(old_sstables, new_sstables);
 }
 
-lw_shared_ptr<sstables::sstable_set>
-table::do_add_sstable(lw_shared_ptr<sstables::sstable_set> sstables, sstables::shared_sstable sstable,
+void
+table::do_add_sstable(sstables::sstable_set& sstables, sstables::shared_sstable sstable,
         enable_backlog_tracker backlog_tracker) {
     if (belongs_to_other_shard(sstable->get_shards_for_this_sstable())) {
         on_internal_error(tlogger, format("Attempted to load the shared SSTable {} at table", sstable->get_filename()));
     }
-    // allow in-progress reads to continue using old list
-    auto new_sstables = make_lw_shared<sstables::sstable_set>(*sstables);
-    new_sstables->insert(sstable);
+    sstables.insert(sstable);
     if (sstable->requires_view_building()) {
         _sstables_staging.emplace(sstable->generation(), sstable);
     } else if (backlog_tracker) {
@@ -403,6 +401,14 @@ table::do_add_sstable(lw_shared_ptr<sstables::sstable_set> sstables, sstables::s
     // update sstable set last in case either updating
     // staging sstables or backlog tracker throws
     update_stats_for_new_sstable(sstable->bytes_on_disk());
+}
+
+lw_shared_ptr<sstables::sstable_set>
+table::do_add_sstable(lw_shared_ptr<sstables::sstable_set> sstables, sstables::shared_sstable sstable,
+        enable_backlog_tracker backlog_tracker) {
+    // allow in-progress reads to continue using old list
+    auto new_sstables = make_lw_shared<sstables::sstable_set>(*sstables);
+    do_add_sstable(*new_sstables, std::move(sstable), backlog_tracker);
     return new_sstables;
 }
 
@@ -458,13 +464,32 @@ table::add_sstable_and_update_cache(sstables::shared_sstable sst, sstables::offs
 
 future<>
 table::add_sstables_and_update_cache(const std::vector<sstables::shared_sstable>& ssts) {
+    if (ssts.empty()) {
+        co_return;
+    }
+    auto permit = co_await seastar::get_units(_sstable_set_mutation_sem, 1);
+    // Cloning the sstable set is linear in its size, so adding the sstables
+    // one at a time would make a large batch (refresh, streamed sstables)
+    // quadratic. Build a single new set with all of them and invalidate the
+    // cache once, over all the affected ranges.
+    dht::partition_range_vector ranges;
+    ranges.reserve(ssts.size());
     for (auto& sst : ssts) {
-        try {
-            co_await do_add_sstable_and_update_cache(sst, sstables::offstrategy::no);
-        } catch (...) {
-            tlogger.error("Failed to load SSTable {}: {}", sst->toc_filename(), std::current_exception());
-            throw;
-        }
+        ranges.push_back(dht::partition_range::make({sst->get_first_decorated_key(), true}, {sst->get_last_decorated_key(), true}));
+    }
+    try {
+        co_await get_row_cache().invalidate(row_cache::external_updater([this, &ssts] () noexcept {
+            // FIXME: this is not really noexcept, but we need to provide strong exception guarantees.
+            auto new_sstables = make_lw_shared<sstables::sstable_set>(*_main_sstables);
+            for (auto& sst : ssts) {
+                do_add_sstable(*new_sstables, sst, enable_backlog_tracker::yes);
+            }
+            _main_sstables = std::move(new_sstables);
+            refresh_compound_sstable_set();
+        }), std::move(ranges));
+    } catch (...) {
+        tlogger.error("Failed to load {} SSTables for {}.{}: {}", ssts.size(), _schema->ks_name(), _schema->cf_name(), std::current_exception());
+        throw;
     }
     trigger_compaction();
 }
@@ -811,6 +836,10 @@ void table::set_metrics() {
                 ms::make_counter("memtable_rows_compacted_with_tombstones", _stats.memtable_app_stats.rows_compacted_with_tombstones, ms::description("Number of rows scanned during write of a tombstone for the purpose of compaction in memtables"))(cf)(ks),
                 ms::make_counter("memtable_range_tombstone_reads", _stats.memtable_range_tombstone_reads, ms::description("Number of range tombstones read from memtables"))(cf)(ks),
                 ms::make_counter("memtable_row_tombstone_reads", _stats.memtable_row_tombstone_reads, ms::description("Number of row tombstones read from memtables"))(cf)(ks),
+                ms::make_gauge("hot_partition_write_estimate", [this] { return _stats.hot_partition_writes.current_max(); },
+                        ms::description("Estimated write count of the hottest partition in the current decay period. "
+                                "Probabilistic upper bound; a persistently high value points at a single partition absorbing "
+                                "a disproportionate share of this table's writes"))(cf)(ks),
                 ms::make_gauge("pending_tasks", ms::description("Estimated number of tasks pending for this column family"), _stats.pending_flushes)(cf)(ks),
                 ms::make_gauge("live_disk_space", ms::description("Live disk space used"), _stats.live_disk_space_used)(cf)(ks),
                 ms::make_gauge("total_disk_space", ms::description("Total disk space used"), _stats.total_disk_space_used)(cf)(ks),
@@ -1973,11 +2002,47 @@ future<> table::apply(const mutation& m, db::rp_handle&& h, db::timeout_clock::t
 
 template void table::do_apply(db::rp_handle&&, const mutation&);
 
+// Feeds the write into the per-table write volume sketch and, when the
+// estimate for the partition crosses the large partition threshold, records
+// the key in the bounded live large partition registry. This catches
+// partitions which grow large while still in the memtable, long before
+// the large_data_handler sees them during an sstable write.
+void table::record_write_size(const frozen_mutation& m, const schema& s) {
+    const auto token = dht::get_token(s, m.key());
+    const uint64_t estimate = _stats.hot_partition_write_bytes.record(token.raw(), m.representation().size());
+    if (estimate < _config.live_large_partition_threshold_bytes) {
+        return;
+    }
+    const auto now = db_clock::now();
+    for (auto& e : _live_large_partitions) {
+        if (e.key.token() == token && e.key.key().equal(s, m.key())) {
+            e.estimated_write_bytes = std::max(e.estimated_write_bytes, estimate);
+            e.detected_at = now;
+            return;
+        }
+    }
+    auto dk = m.decorated_key(s);
+    tlogger.warn("Writing large partition {}/{}: {} (~{} bytes within the sampling window)",
+            s.ks_name(), s.cf_name(), dk.key().with_schema(s), estimate);
+    if (_live_large_partitions.size() < max_live_large_partitions) {
+        _live_large_partitions.push_back(live_large_partition{std::move(dk), estimate, now});
+        return;
+    }
+    // Replace the entry which has gone the longest without re-crossing the
+    // threshold; persistently large partitions keep refreshing their slot.
+    auto it = boost::range::min_element(_live_large_partitions, [] (const live_large_partition& a, const live_large_partition& b) {
+        return a.detected_at < b.detected_at;
+    });
+    *it = live_large_partition{std::move(dk), estimate, now};
+}
+
 future<> table::apply(const frozen_mutation& m, schema_ptr m_schema, db::rp_handle&& h, db::timeout_clock::time_point timeout) {
     if (_virtual_writer) [[unlikely]] {
         return (*_virtual_writer)(m);
     }
 
+    record_write_size(m, *m_schema);
+
     return dirty_memory_region_group().run_when_memory_available([this, &m, m_schema = std::move(m_schema), h = std::move(h)]() mutable {
         do_apply(std::move(h), m, m_schema);
     }, timeout);
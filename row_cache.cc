@@ -125,6 +125,7 @@ cache_tracker::setup_metrics() {
         sm::make_counter("mispopulations", sm::description("number of entries not inserted by reads"), _stats.mispopulations),
         sm::make_gauge("partitions", sm::description("total number of cached partitions"), _stats.partitions),
         sm::make_gauge("rows", sm::description("total number of cached rows"), _stats.rows),
+        sm::make_gauge("pinned_rows", sm::description("number of cached rows pinned by the user and excluded from eviction"), _stats.pinned_rows),
         sm::make_counter("reads", sm::description("number of started reads"), _stats.reads),
         sm::make_counter("reads_with_misses", sm::description("number of reads which had to read from sstables"), _stats.reads_with_misses),
         sm::make_gauge("active_reads", sm::description("number of currently active reads"), [this] { return _stats.active_reads(); }),
@@ -155,6 +156,8 @@ void cache_tracker::clear() {
         _memtable_cleaner.clear();
         current_tracker = this;
         _lru.evict_all();
+        // Pinned entries are immune to memory pressure, but not to clear().
+        _pinned_lru.evict_all();
     });
     _stats.partition_removals += partitions_before;
     _stats.row_removals += rows_before;
@@ -162,10 +165,15 @@ void cache_tracker::clear() {
 }
 
 void cache_tracker::touch(rows_entry& e) {
-    // last dummy may not be linked if evicted, but
-    // the unlink_from_lru() handles it
-    e.unlink_from_lru();
-    _lru.add(e);
+    // Pinned entries live on the pinned list and must not be moved
+    // back to the eviction LRU by reads.
+    if (e.pinned()) {
+        return;
+    }
+    // last dummy may not be linked if evicted; lru::touch() handles it.
+    // The touch also marks the entry referenced, which promotes it from the
+    // probationary to the protected LRU segment lazily, see utils/lru.hh.
+    _lru.touch(e);
 }
 
 void cache_tracker::insert(cache_entry& entry) {
@@ -1100,6 +1108,47 @@ void row_cache::unlink_from_lru(const dht::decorated_key& dk) {
     });
 }
 
+bool row_cache::pin(const dht::decorated_key& dk) {
+    return _read_section(_tracker.region(), [&] {
+        auto i = _partitions.find(dk, dht::ring_position_comparator(*_schema));
+        if (i == _partitions.end()) {
+            return false;
+        }
+        uint64_t unpinned_rows = 0;
+        for (partition_version& pv : i->partition().versions_from_oldest()) {
+            for (rows_entry& row : pv.partition().clustered_rows()) {
+                unpinned_rows += !row.pinned();
+            }
+        }
+        if (!_tracker.can_pin(unpinned_rows)) {
+            return false;
+        }
+        for (partition_version& pv : i->partition().versions_from_oldest()) {
+            for (rows_entry& row : pv.partition().clustered_rows()) {
+                if (!row.pinned()) {
+                    _tracker.pin(row);
+                }
+            }
+        }
+        return true;
+    });
+}
+
+void row_cache::unpin(const dht::decorated_key& dk) {
+    _read_section(_tracker.region(), [&] {
+        auto i = _partitions.find(dk, dht::ring_position_comparator(*_schema));
+        if (i != _partitions.end()) {
+            for (partition_version& pv : i->partition().versions_from_oldest()) {
+                for (rows_entry& row : pv.partition().clustered_rows()) {
+                    if (row.pinned()) {
+                        _tracker.unpin(row);
+                    }
+                }
+            }
+        }
+    });
+}
+
 void row_cache::invalidate_locked(const dht::decorated_key& dk) {
     auto pos = _partitions.lower_bound(dk, dht::ring_position_comparator(*_schema));
     if (pos == partitions_end() || !pos->key().equal(*_schema, dk)) {
@@ -1221,6 +1270,11 @@ void cache_entry::on_evicted(cache_tracker& tracker) noexcept {
 }
 
 void rows_entry::on_evicted(cache_tracker& tracker) noexcept {
+    if (pinned()) {
+        set_pinned(false);
+        tracker.on_row_unpinned();
+    }
+
     mutation_partition::rows_type::iterator it(this);
 
     if (is_last_dummy()) {
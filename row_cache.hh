@@ -425,6 +425,18 @@ public:
     // that they are not evicted by memory reclaimer.
     void unlink_from_lru(const dht::decorated_key&);
 
+    // Pins the current contents of given partition so that memory pressure
+    // cannot evict them, subject to the tracker-wide pinned row budget.
+    // Returns false if the partition is not cached or the budget is exhausted.
+    // Rows populated into the partition after this call are evictable until
+    // pin() is called again, so pins of write-active partitions should be
+    // refreshed periodically.
+    bool pin(const dht::decorated_key&);
+
+    // Makes a previously pinned partition evictable again. No-op if the
+    // partition is not cached or not pinned.
+    void unpin(const dht::decorated_key&);
+
     // Synchronizes cache with the underlying mutation source
     // by invalidating ranges which were modified. This will force
     // them to be re-read from the underlying mutation source
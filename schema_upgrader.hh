@@ -12,18 +12,67 @@
 #include "mutation_fragment_v2.hh"
 #include "converting_mutation_partition_applier.hh"
 
+// Maps each column id of the old schema to the matching column of the new
+// schema (nullptr for columns which no longer exist), so that fragment
+// transformation doesn't resolve columns by name for every cell.
+class schema_upgrader_column_mapping {
+    std::vector<const column_definition*> _columns[2];
+    bool _identity = false;
+private:
+    std::vector<const column_definition*>& columns_for(column_kind kind) {
+        return _columns[kind == column_kind::static_column ? 0 : 1];
+    }
+    // Returns true iff the new schema has the same columns with the same
+    // ids and types for the given kind, so that rows can be forwarded
+    // without rewriting them cell by cell.
+    bool prepare(const schema& prev, const schema& next, column_kind kind) {
+        auto& map = columns_for(kind);
+        map.clear();
+        const auto count = prev.columns_count(kind);
+        map.reserve(count);
+        bool identity = count == next.columns_count(kind);
+        for (column_id id = 0; id < count; ++id) {
+            const column_definition& col = prev.column_at(kind, id);
+            const column_definition* new_col = next.get_column_definition(col.name());
+            map.push_back(new_col);
+            identity = identity && new_col
+                    && new_col->kind == kind
+                    && new_col->id == id
+                    && new_col->type == col.type
+                    // A re-added column filters out cells older than the drop,
+                    // so it cannot be forwarded untouched.
+                    && new_col->dropped_at() == api::missing_timestamp;
+        }
+        return identity;
+    }
+public:
+    void prepare(const schema& prev, const schema& next) {
+        bool statics = prepare(prev, next, column_kind::static_column);
+        bool regulars = prepare(prev, next, column_kind::regular_column);
+        _identity = statics && regulars;
+    }
+    const column_definition* operator()(column_kind kind, column_id id) {
+        return columns_for(kind)[id];
+    }
+    // True iff rows conforming to the old schema are also valid under the
+    // new one, making transformation a no-op.
+    bool is_identity() const {
+        return _identity;
+    }
+};
+
 // A StreamedMutationTransformer which transforms the stream to a different schema
 class schema_upgrader {
     schema_ptr _prev;
     schema_ptr _new;
     std::optional<reader_permit> _permit;
+    schema_upgrader_column_mapping _mapping;
 private:
     row transform(row&& r, column_kind kind) {
         row new_row;
         r.for_each_cell([&] (column_id id, atomic_cell_or_collection& cell) {
-            const column_definition& col = _prev->column_at(kind, id);
-            const column_definition* new_col = _new->get_column_definition(col.name());
-            if (new_col) {
+            if (const column_definition* new_col = _mapping(kind, id)) {
+                const column_definition& col = _prev->column_at(kind, id);
                 converting_mutation_partition_applier::append_cell(new_row, kind, *new_col, col, std::move(cell));
             }
         });
@@ -35,12 +84,19 @@ public:
     { }
     schema_ptr operator()(schema_ptr old) {
         _prev = std::move(old);
+        _mapping.prepare(*_prev, *_new);
         return _new;
     }
     mutation_fragment consume(static_row&& row) {
+        if (_mapping.is_identity()) {
+            return mutation_fragment(*_new, std::move(*_permit), std::move(row));
+        }
         return mutation_fragment(*_new, std::move(*_permit), static_row(transform(std::move(row.cells()), column_kind::static_column)));
     }
     mutation_fragment consume(clustering_row&& row) {
+        if (_mapping.is_identity()) {
+            return mutation_fragment(*_new, std::move(*_permit), std::move(row));
+        }
         return mutation_fragment(*_new, std::move(*_permit), clustering_row(row.key(), row.tomb(), row.marker(),
             transform(std::move(row.cells()), column_kind::regular_column)));
     }
@@ -64,13 +120,13 @@ class schema_upgrader_v2 {
     schema_ptr _prev;
     schema_ptr _new;
     std::optional<reader_permit> _permit;
+    schema_upgrader_column_mapping _mapping;
 private:
     row transform(row&& r, column_kind kind) {
         row new_row;
         r.for_each_cell([&] (column_id id, atomic_cell_or_collection& cell) {
-            const column_definition& col = _prev->column_at(kind, id);
-            const column_definition* new_col = _new->get_column_definition(col.name());
-            if (new_col) {
+            if (const column_definition* new_col = _mapping(kind, id)) {
+                const column_definition& col = _prev->column_at(kind, id);
                 converting_mutation_partition_applier::append_cell(new_row, kind, *new_col, col, std::move(cell));
             }
         });
@@ -82,12 +138,19 @@ public:
     { }
     schema_ptr operator()(schema_ptr old) {
         _prev = std::move(old);
+        _mapping.prepare(*_prev, *_new);
         return _new;
     }
     mutation_fragment_v2 consume(static_row&& row) {
+        if (_mapping.is_identity()) {
+            return mutation_fragment_v2(*_new, std::move(*_permit), std::move(row));
+        }
         return mutation_fragment_v2(*_new, std::move(*_permit), static_row(transform(std::move(row.cells()), column_kind::static_column)));
     }
     mutation_fragment_v2 consume(clustering_row&& row) {
+        if (_mapping.is_identity()) {
+            return mutation_fragment_v2(*_new, std::move(*_permit), std::move(row));
+        }
         return mutation_fragment_v2(*_new, std::move(*_permit), clustering_row(row.key(), row.tomb(), row.marker(),
             transform(std::move(row.cells()), column_kind::regular_column)));
     }
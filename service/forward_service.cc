@@ -263,6 +263,32 @@ future<query::forward_result> forward_service::execute_on_this_shard(
         retain_ranges_owned_by_this_shard(schema, std::move(req.pr)),
         nullptr // No filtering restrictions
     );
+    // count(*) needs nothing but the number of rows, which the query
+    // results already carry. Consume pages through the row-count path,
+    // which skips materializing the rows and pushing each of them
+    // through the selectors.
+    bool count_only = std::all_of(req.reduction_types.begin(), req.reduction_types.end(), [] (const query::forward_request::reduction_type& type) {
+        return type == query::forward_request::reduction_type::count;
+    });
+    if (count_only) {
+        uint64_t row_count = 0;
+        while (!pager->is_exhausted()) {
+            row_count += co_await pager->fetch_page_row_count(DEFAULT_INTERNAL_PAGING_SIZE, now, timeout);
+        }
+        auto serialized_count = data_value(int64_t(row_count)).serialize();
+        query::forward_result res = {
+            .query_results = std::vector<bytes_opt>(req.reduction_types.size(), serialized_count)
+        };
+
+        query::forward_result::printer res_printer{
+            .types = req.reduction_types,
+            .res = res
+        };
+        tracing::trace(tr_state, "On shard execution result is {}", res_printer);
+
+        co_return res;
+    }
+
     auto rs_builder = cql3::selection::result_set_builder(
         *selection,
         now,
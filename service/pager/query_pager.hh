@@ -102,6 +102,17 @@ public:
     future<cql3::result_generator> fetch_page_generator(uint32_t page_size, gc_clock::time_point now, db::timeout_clock::time_point timeout, cql3::cql_stats& stats);
     future<result<cql3::result_generator>> fetch_page_generator_result(uint32_t page_size, gc_clock::time_point now, db::timeout_clock::time_point timeout, cql3::cql_stats& stats);
 
+    /**
+     * Fetches the next page and returns only the number of live CQL rows
+     * it contained, without materializing any of them. Meant for
+     * count(*)-style aggregation which needs nothing but the count, which
+     * the query result already carries. Must not be used with pagers which
+     * drop rows after the fact (see filtering_query_pager), since the
+     * count is taken from the result before any filtering.
+     */
+    future<uint64_t> fetch_page_row_count(uint32_t page_size, gc_clock::time_point now, db::timeout_clock::time_point timeout);
+    future<result<uint64_t>> fetch_page_row_count_result(uint32_t page_size, gc_clock::time_point now, db::timeout_clock::time_point timeout);
+
     /**
      * Whether or not this pager is exhausted, i.e. whether or not a call to
      * fetchPage may return more result.
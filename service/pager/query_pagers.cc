@@ -232,6 +232,22 @@ future<result<cql3::result_generator>> query_pager::fetch_page_generator_result(
     }));
 }
 
+future<uint64_t> query_pager::fetch_page_row_count(uint32_t page_size, gc_clock::time_point now, db::timeout_clock::time_point timeout) {
+    return fetch_page_row_count_result(page_size, now, timeout)
+            .then(utils::result_into_future<result<uint64_t>>);
+}
+
+future<result<uint64_t>> query_pager::fetch_page_row_count_result(uint32_t page_size, gc_clock::time_point now, db::timeout_clock::time_point timeout) {
+    return do_fetch_page(page_size, now, timeout).then(utils::result_wrap([this, page_size, now] (service::storage_proxy::coordinator_query_result qr) -> future<result<uint64_t>> {
+        _last_replicas = std::move(qr.last_replicas);
+        _query_read_repair_decision = qr.read_repair_decision;
+        qr.query_result->ensure_counts();
+        uint64_t row_count = *qr.query_result->row_count();
+        handle_result(noop_visitor(), qr.query_result, page_size, now);
+        return make_ready_future<result<uint64_t>>(bo::success(row_count));
+    }));
+}
+
 class filtering_query_pager : public query_pager {
     ::shared_ptr<cql3::restrictions::statement_restrictions> _filtering_restrictions;
 public:
@@ -1862,6 +1862,25 @@ void storage_proxy::connection_dropped(gms::inet_address addr) {
     for (auto&& cf : _db.local().get_non_system_column_families()) {
         cf->drop_hit_rate(addr);
     }
+    _replica_read_latencies.erase(addr);
+}
+
+void storage_proxy::register_replica_read_latency(gms::inet_address ep, utils::estimated_histogram::duration latency) {
+    _replica_read_latencies[ep].histogram.add(std::chrono::duration_cast<std::chrono::microseconds>(latency).count());
+}
+
+std::chrono::microseconds storage_proxy::replica_read_latency_median(gms::inet_address ep) {
+    auto it = _replica_read_latencies.find(ep);
+    if (it == _replica_read_latencies.end()) {
+        return std::chrono::microseconds(0);
+    }
+    auto& rl = it->second;
+    if (lowres_clock::now() - rl.cache_timestamp > 1s) {
+        rl.cache_timestamp = lowres_clock::now();
+        rl.cached_median = std::chrono::microseconds(rl.histogram.percentile(0.5));
+        rl.histogram *= 0.9; // decay values a little to give new data points more weight
+    }
+    return rl.cached_median;
 }
 
 future<>
@@ -1891,8 +1910,24 @@ storage_proxy::mutate_locally(const schema_ptr& s, const frozen_mutation& m, tra
 
 future<>
 storage_proxy::mutate_locally(std::vector<mutation> mutations, tracing::trace_state_ptr tr_state, clock_type::time_point timeout, smp_service_group smp_grp) {
-    co_await coroutine::parallel_for_each(mutations, [&] (const mutation& m) mutable {
-            return mutate_locally(m, tr_state, db::commitlog::force_sync::no, timeout, smp_grp);
+    // Group the mutations by the shard which owns them, so that a batch
+    // costs one smp crossing per destination shard instead of one per
+    // mutation. The mutations of a group are still applied in parallel,
+    // like they were when each took its own crossing.
+    std::unordered_map<unsigned, std::vector<std::pair<global_schema_ptr, frozen_mutation>>> by_shard;
+    for (const mutation& m : mutations) {
+        auto shard = m.shard_of();
+        get_stats().replica_cross_shard_ops += shard != this_shard_id();
+        by_shard[shard].emplace_back(global_schema_ptr(m.schema()), freeze(m));
+    }
+    auto gtr = tracing::global_trace_state_ptr(std::move(tr_state));
+    co_await coroutine::parallel_for_each(by_shard, [&] (auto& shard_and_muts) {
+        return _db.invoke_on(shard_and_muts.first, {smp_grp, timeout},
+                [&muts = shard_and_muts.second, gtr, timeout] (replica::database& db) {
+            return parallel_for_each(muts, [&db, gtr, timeout] (std::pair<global_schema_ptr, frozen_mutation>& m) {
+                return db.apply(m.first, m.second, gtr.get(), db::commitlog::force_sync::no, timeout);
+            });
+        });
     });
 }
 
@@ -3629,6 +3664,7 @@ protected:
                     ++_proxy->get_stats().data_read_completed.get_ep_stat(ep);
                     _used_targets.push_back(ep);
                     register_request_latency(latency_clock::now() - start);
+                    _proxy->register_replica_read_latency(ep, latency_clock::now() - start);
                 } catch(...) {
                     ++_proxy->get_stats().data_read_errors.get_ep_stat(ep);
                     resolver->error(ep, std::current_exception());
@@ -3648,6 +3684,7 @@ protected:
                     ++_proxy->get_stats().digest_read_completed.get_ep_stat(ep);
                     _used_targets.push_back(ep);
                     register_request_latency(latency_clock::now() - start);
+                    _proxy->register_replica_read_latency(ep, latency_clock::now() - start);
                 } catch(...) {
                     ++_proxy->get_stats().digest_read_errors.get_ep_stat(ep);
                     resolver->error(ep, std::current_exception());
@@ -3788,6 +3825,42 @@ public:
             // Return an empty result in this case
             return make_ready_future<result<foreign_ptr<lw_shared_ptr<query::result>>>>(make_foreign(make_lw_shared(query::result())));
         }
+        // Fast path for the most common request shape in a token-aware fleet:
+        // a single-partition read at CL=ONE/LOCAL_ONE whose only target is
+        // this node. There is nothing to resolve -- no digests to compare, no
+        // other replies to wait for and no read repair to trigger -- so skip
+        // the digest resolver (and its timer) and complete with the local
+        // read directly. Errors are translated to the same coordinator
+        // exceptions the resolver would have produced.
+        if (_targets.size() == 1 && _block_for == 1 && fbu::is_me(_targets.front())) {
+            auto start = latency_clock::now();
+            // Waited on through _result_promise, shared_from_this keeps `this` alive
+            (void)make_data_request(_targets.front(), timeout, false).then_wrapped([this, start, exec = shared_from_this()] (future<rpc::tuple<foreign_ptr<lw_shared_ptr<query::result>>, cache_temperature>> f) {
+                auto ep = _targets.front();
+                try {
+                    auto v = f.get0();
+                    _cf->set_hit_rate(ep, std::get<1>(v));
+                    ++_proxy->get_stats().data_read_completed.get_ep_stat(ep);
+                    _used_targets.push_back(ep);
+                    auto latency = latency_clock::now() - start;
+                    register_request_latency(latency);
+                    _proxy->register_replica_read_latency(ep, latency);
+                    _result_promise.set_value(std::get<0>(std::move(v)));
+                } catch (timed_out_error&) {
+                    ++_proxy->get_stats().data_read_errors.get_ep_stat(ep);
+                    _result_promise.set_value(exceptions::coordinator_exception_container(read_timeout_exception(_schema->ks_name(), _schema->cf_name(), _cl, 0, 1, false)));
+                } catch (semaphore_timed_out&) {
+                    ++_proxy->get_stats().data_read_errors.get_ep_stat(ep);
+                    _result_promise.set_value(exceptions::coordinator_exception_container(read_timeout_exception(_schema->ks_name(), _schema->cf_name(), _cl, 0, 1, false)));
+                } catch (...) {
+                    ++_proxy->get_stats().data_read_errors.get_ep_stat(ep);
+                    slogger.error("Exception when reading locally from {}.{}: {}", _schema->ks_name(), _schema->cf_name(), std::current_exception());
+                    _result_promise.set_value(exceptions::coordinator_exception_container(read_failure_exception(_schema->ks_name(), _schema->cf_name(), _cl, 0, 1, 1, false)));
+                }
+                on_read_resolved();
+            });
+            return _result_promise.get_future();
+        }
         digest_resolver_ptr digest_resolver = ::make_shared<digest_read_resolver>(_schema, _cl, _block_for,
                 db::is_datacenter_local(_cl) ? db::count_local_endpoints(_targets): _targets.size(), timeout);
         auto exec = shared_from_this();
@@ -4038,6 +4111,24 @@ db::read_repair_decision storage_proxy::new_read_repair_decision(const schema& s
         }
     }
 
+    // The executors contact targets front to back and only reach for the
+    // last one when speculating, so give that slot to the replica which
+    // currently looks slowest (compacting, GCing): digest reads shift to the
+    // healthier replicas without dropping the slow one from the plan. Only
+    // demote on a clear signal — an unmeasured replica reads as zero, and a
+    // healthy spread should not override the snitch's proximity order.
+    if (target_replicas.size() > 1) {
+        auto slowest = std::max_element(target_replicas.begin(), target_replicas.end(),
+                [this] (gms::inet_address a, gms::inet_address b) {
+                    return replica_read_latency_median(a) < replica_read_latency_median(b);
+                });
+        if (std::next(slowest) != target_replicas.end()
+                && replica_read_latency_median(*slowest) >= 2 * replica_read_latency_median(target_replicas.back())
+                && replica_read_latency_median(*slowest) > 0us) {
+            std::rotate(slowest, std::next(slowest), target_replicas.end());
+        }
+    }
+
     if (retry_type == speculative_retry::type::ALWAYS) {
         return ::make_shared<always_speculating_read_executor>(schema, cf, p, cmd, std::move(pr), cl, block_for, std::move(target_replicas), std::move(trace_state), std::move(permit));
     } else {// PERCENTILE or CUSTOM.
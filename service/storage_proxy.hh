@@ -274,6 +274,17 @@ private:
     db::view::node_update_backlog& _max_view_update_backlog;
     std::unordered_map<gms::inet_address, view_update_backlog_timestamped> _view_update_backlogs;
 
+    // Decaying per-replica read latency estimate, fed by the read executors
+    // with the coordinator-observed latency of every data/digest request.
+    // Follows the same decay-and-cache scheme as
+    // table::get_coordinator_read_latency_percentile().
+    struct replica_read_latency {
+        utils::estimated_histogram histogram;
+        lowres_clock::time_point cache_timestamp;
+        std::chrono::microseconds cached_median{0};
+    };
+    std::unordered_map<gms::inet_address, replica_read_latency> _replica_read_latencies;
+
     //NOTICE(sarna): This opaque pointer is here just to avoid moving write handler class definitions from .cc to .hh. It's slow path.
     class view_update_handlers_list;
     std::unique_ptr<view_update_handlers_list> _view_update_handlers_list;
@@ -423,6 +434,11 @@ private:
 
     void retire_view_response_handlers(noncopyable_function<bool(const abstract_write_response_handler&)> filter_fun);
     void connection_dropped(gms::inet_address);
+
+    void register_replica_read_latency(gms::inet_address ep, utils::estimated_histogram::duration latency);
+    // Decayed median of the coordinator-observed read latency of the given
+    // replica, or zero if the replica has not been measured yet.
+    std::chrono::microseconds replica_read_latency_median(gms::inet_address ep);
 private:
     future<> handle_counter_mutation(const rpc::client_info& cinfo, rpc::opt_time_point t, std::vector<frozen_mutation> fms, db::consistency_level cl, std::optional<tracing::trace_info> trace_info);
     future<rpc::no_wait_type> handle_write(netw::msg_addr src_addr, rpc::opt_time_point t,
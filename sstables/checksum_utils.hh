@@ -91,6 +91,19 @@ struct libdeflate_crc32_checksummer {
     static constexpr bool prefer_combine() { return false; }
 };
 
+// Checksums a chain of fragments as if it were one contiguous buffer,
+// without coalescing it. The underlying kernels (libdeflate for CRC32,
+// dispatched at runtime to PCLMUL/AVX-accelerated variants) are fed each
+// fragment incrementally, so no memcpy of the data is needed.
+template<typename Checksum, typename FragmentRange>
+requires ChecksumUtils<Checksum>
+inline uint32_t checksum_fragmented(uint32_t prev, const FragmentRange& fragments) {
+    for (auto&& f : fragments) {
+        prev = Checksum::checksum(prev, reinterpret_cast<const char*>(f.data()), f.size());
+    }
+    return prev;
+}
+
 template<typename Checksum>
 inline uint32_t checksum_combine_or_feed(uint32_t first, uint32_t second, const char* input, size_t input_len) {
     if constexpr (Checksum::prefer_combine()) {
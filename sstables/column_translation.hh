@@ -59,9 +59,15 @@ private:
                 const schema& s,
                 const utils::chunked_vector<serialization_header::column_desc>& src,
                 const sstable_enabled_features& features,
-                bool is_static);
+                bool is_static,
+                utils::chunked_vector<bytes>& name_storage);
 
         utils::UUID schema_uuid;
+        // Owns the column names the column_info entries point to, so that the
+        // state is self-contained and can be shared across sstables instead
+        // of referencing one sstable's serialization header. chunked_vector
+        // never relocates existing elements, keeping the pointers stable.
+        utils::chunked_vector<bytes> column_names;
         std::vector<column_info> regular_schema_columns_from_sstable;
         std::vector<column_info> static_schema_columns_from_sstable;
         column_values_fixed_lengths clustering_column_value_fix_lengths;
@@ -74,10 +80,12 @@ private:
 
         state(const schema& s, const serialization_header& header, const sstable_enabled_features& features)
             : schema_uuid(s.version())
-            , regular_schema_columns_from_sstable(build(s, header.regular_columns.elements, features, false))
-            , static_schema_columns_from_sstable(build(s, header.static_columns.elements, features, true))
+            , regular_schema_columns_from_sstable(build(s, header.regular_columns.elements, features, false, column_names))
+            , static_schema_columns_from_sstable(build(s, header.static_columns.elements, features, true, column_names))
             , clustering_column_value_fix_lengths (get_clustering_values_fixed_lengths(header))
         {}
+
+        bool equal_content(const state& o) const;
     };
 
     lw_shared_ptr<const state> _state = make_lw_shared<const state>();
@@ -91,6 +99,23 @@ public:
         return *this;
     }
 
+    // True if the cached state was built for the given schema version.
+    bool matches(const utils::UUID& schema_version) const {
+        return _state->schema_uuid == schema_version;
+    }
+
+    // True if both instances would translate columns identically. Used by
+    // sstables_manager to intern states across generations of a table.
+    bool same_translation(const column_translation& o) const {
+        return _state == o._state || _state->equal_content(*o._state);
+    }
+
+    // True if this is the only handle referencing the underlying state,
+    // i.e. no sstable is using it.
+    bool state_unshared() const {
+        return _state.use_count() == 1;
+    }
+
     const std::vector<column_info>& regular_columns() const {
         return _state->regular_schema_columns_from_sstable;
     }
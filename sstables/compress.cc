@@ -26,6 +26,65 @@ namespace sstables {
 
 extern logging::logger sstlog;
 
+void uncompressed_chunk_cache::entry::on_evicted() noexcept {
+    auto& p = parent;
+    p._size -= data.size();
+    p._stats.evictions++;
+    p._entries.erase(key); // destroys *this
+}
+
+uncompressed_chunk_cache::~uncompressed_chunk_cache() {
+    while (_lru.evict() == lru::reclaiming_result::reclaimed_something) {
+    }
+}
+
+uint64_t uncompressed_chunk_cache::next_id() noexcept {
+    static thread_local uint64_t next = 0;
+    return next++;
+}
+
+uncompressed_chunk_cache& uncompressed_chunk_cache::instance() {
+    static constexpr size_t default_capacity = 16 << 20;
+    static thread_local uncompressed_chunk_cache cache(default_capacity);
+    return cache;
+}
+
+temporary_buffer<char> uncompressed_chunk_cache::get(uint64_t id, uint64_t chunk_start) {
+    auto it = _entries.find(key_type(id, chunk_start));
+    if (it == _entries.end()) {
+        _stats.misses++;
+        return {};
+    }
+    _lru.touch(it->second);
+    _stats.hits++;
+    return it->second.data.share();
+}
+
+void uncompressed_chunk_cache::put(uint64_t id, uint64_t chunk_start, temporary_buffer<char> data) {
+    if (data.size() > _capacity) {
+        return;
+    }
+    auto key = key_type(id, chunk_start);
+    auto [it, inserted] = _entries.emplace(std::piecewise_construct,
+            std::forward_as_tuple(key),
+            std::forward_as_tuple(*this, key, std::move(data)));
+    if (!inserted) {
+        return;
+    }
+    _size += it->second.data.size();
+    _lru.add(it->second);
+    while (_size > _capacity) {
+        _lru.evict();
+    }
+}
+
+void uncompressed_chunk_cache::set_capacity(size_t capacity) {
+    _capacity = capacity;
+    while (_size > _capacity) {
+        _lru.evict();
+    }
+}
+
 enum class mask_type : uint8_t {
     set,
     clear
@@ -385,6 +444,16 @@ public:
         if (_pos != _beg_pos && addr.offset != 0) {
             throw std::runtime_error("compressed reader out of sync");
         }
+        if (auto cached = uncompressed_chunk_cache::instance().get(_compression_metadata->chunk_cache_id(), addr.chunk_start); !cached.empty()) {
+            // Cache hit: skip the compressed chunk in the underlying stream
+            // and serve the uncompressed data without decompressing again.
+            return _input_stream->skip(addr.chunk_len).then([this, addr, out = std::move(cached)] () mutable {
+                out.trim_front(addr.offset);
+                _pos += out.size();
+                _underlying_pos += addr.chunk_len;
+                return std::move(out);
+            });
+        }
         return _input_stream->read_exactly(addr.chunk_len).
             then([this, addr](temporary_buffer<char> buf) {
                 // The last 4 bytes of the chunk are the adler32/crc32 checksum
@@ -408,6 +477,7 @@ public:
                 auto len = _compression.uncompress(buf.get(), compressed_len, out.get_write(), out.size());
 
                 out.trim(len);
+                uncompressed_chunk_cache::instance().put(_compression_metadata->chunk_cache_id(), addr.chunk_start, out.share());
                 out.trim_front(addr.offset);
                 _pos += out.size();
                 _underlying_pos += addr.chunk_len;
@@ -480,6 +550,11 @@ class compressed_file_data_sink_impl : public data_sink_impl {
     sstables::local_compression _compression;
     size_t _pos = 0;
     uint32_t _full_checksum;
+    // Compression scratch, reused across put() calls to avoid allocating
+    // and freeing a chunk-sized buffer for every chunk written. This is
+    // safe since the next put() starts only after the write of the
+    // previous chunk completed, and the sink outlives all pending writes.
+    temporary_buffer<char> _compressed;
 public:
     compressed_file_data_sink_impl(output_stream<char> out, sstables::compression* cm, sstables::local_compression lc)
             : _out(std::move(out))
@@ -494,10 +569,14 @@ public:
         auto output_len = _compression.compress_max_size(buf.size());
 
         // account space for checksum that goes after compressed data.
-        temporary_buffer<char> compressed(output_len + 4);
+        // All chunks but the last have the same size, so the scratch is
+        // allocated once per sstable.
+        if (_compressed.size() < output_len + 4) {
+            _compressed = temporary_buffer<char>(output_len + 4);
+        }
 
         // compress flushed data.
-        auto len = _compression.compress(buf.get(), buf.size(), compressed.get_write(), output_len);
+        auto len = _compression.compress(buf.get(), buf.size(), _compressed.get_write(), output_len);
         if (len > output_len) {
             return make_exception_future(std::runtime_error("possible overflow during compression"));
         }
@@ -511,11 +590,11 @@ public:
         _compression_metadata->set_compressed_file_length(_pos);
 
         // compute 32-bit checksum for compressed data.
-        uint32_t per_chunk_checksum = ChecksumType::checksum(compressed.get(), len);
-        _full_checksum = checksum_combine_or_feed<ChecksumType>(_full_checksum, per_chunk_checksum, compressed.get(), len);
+        uint32_t per_chunk_checksum = ChecksumType::checksum(_compressed.get(), len);
+        _full_checksum = checksum_combine_or_feed<ChecksumType>(_full_checksum, per_chunk_checksum, _compressed.get(), len);
 
         // write checksum into buffer after compressed data.
-        write_be<uint32_t>(compressed.get_write() + len, per_chunk_checksum);
+        write_be<uint32_t>(_compressed.get_write() + len, per_chunk_checksum);
 
         if constexpr (mode == compressed_checksum_mode::checksum_all) {
             uint32_t be_per_chunk_checksum = cpu_to_be(per_chunk_checksum);
@@ -525,10 +604,7 @@ public:
 
         _compression_metadata->set_full_checksum(_full_checksum);
 
-        compressed.trim(len + 4);
-
-        auto f = _out.write(compressed.get(), compressed.size());
-        return f.then([compressed = std::move(compressed)] {});
+        return _out.write(_compressed.get(), len + 4);
     }
     virtual future<> close() override {
         return _out.close();
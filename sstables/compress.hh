@@ -36,15 +36,19 @@
 #include <vector>
 #include <cstdint>
 #include <iterator>
+#include <unordered_map>
 
 #include <seastar/core/file.hh>
 #include <seastar/core/seastar.hh>
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/core/fstream.hh>
+#include <seastar/core/temporary_buffer.hh>
 
 #include "types.hh"
 #include "sstables/types.hh"
 #include "checksum_utils.hh"
+#include "utils/lru.hh"
+#include "utils/hash.hh"
 #include "../compress.hh"
 
 class compression_parameters;
@@ -55,6 +59,66 @@ namespace sstables {
 
 struct compression;
 
+// Shard-local cache of uncompressed sstable data chunks.
+//
+// Reads going through the compressed data source pay an LZ4/ZSTD/...
+// decompression for every chunk they touch, even when point reads that miss
+// the row cache keep hitting the same hot chunks over and over. This cache
+// keeps recently decompressed chunks around, keyed by a unique identity of
+// the file's compression metadata and the chunk's position in the compressed
+// file, so hot data files stop paying repeated decompression.
+//
+// The footprint is bounded by a per-shard byte budget with LRU replacement.
+// Identities are never reused, so entries belonging to deleted sstables
+// simply age out of the LRU; no explicit invalidation is needed.
+class uncompressed_chunk_cache {
+public:
+    struct stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+    };
+private:
+    using key_type = std::pair<uint64_t, uint64_t>; // (identity, chunk start)
+    struct entry : public evictable {
+        uncompressed_chunk_cache& parent;
+        key_type key;
+        temporary_buffer<char> data;
+        entry(uncompressed_chunk_cache& parent, key_type key, temporary_buffer<char> data)
+            : parent(parent), key(key), data(std::move(data)) {}
+        entry(entry&&) = delete;
+        virtual void on_evicted() noexcept override;
+    };
+    std::unordered_map<key_type, entry, utils::tuple_hash> _entries;
+    lru _lru;
+    size_t _size = 0;
+    size_t _capacity;
+    stats _stats;
+public:
+    explicit uncompressed_chunk_cache(size_t capacity) : _capacity(capacity) {}
+    ~uncompressed_chunk_cache();
+
+    // Returns a new, never before used identity for keying a compressed
+    // file's chunks.
+    static uint64_t next_id() noexcept;
+
+    // The per-shard instance used by the compressed data source.
+    static uncompressed_chunk_cache& instance();
+
+    // Returns the uncompressed chunk starting at the given position in the
+    // compressed file (trimmed to its actual length), or an empty buffer on
+    // miss.
+    temporary_buffer<char> get(uint64_t id, uint64_t chunk_start);
+
+    // Caches an uncompressed chunk. The buffer is shared, not copied.
+    void put(uint64_t id, uint64_t chunk_start, temporary_buffer<char> data);
+
+    // Changes the byte budget, evicting as needed to fit it.
+    void set_capacity(size_t capacity);
+
+    const stats& get_stats() const noexcept { return _stats; }
+};
+
 struct compression {
     // To reduce the memory footpring of compression-info, n offsets are grouped
     // together into segments, where each segment stores a base absolute offset
@@ -301,7 +365,12 @@ private:
     // Variables *not* found in the "Compression Info" file (added by update()):
     uint64_t _compressed_file_length = 0;
     uint32_t _full_checksum = 0;
+    // Identity used to key this file's chunks in the uncompressed chunk cache.
+    uint64_t _chunk_cache_id = uncompressed_chunk_cache::next_id();
 public:
+    uint64_t chunk_cache_id() const noexcept {
+        return _chunk_cache_id;
+    }
     // Set the compressor algorithm, please check the definition of enum compressor.
     void set_compressor(compressor_ptr c);
     // After changing _compression, update() must be called to update
@@ -128,8 +128,8 @@ private:
         } else {
             const vint_size_type len = VintType::serialized_size_from_first_byte(*data.begin());
             if (data.size() >= len) {
-                dest = VintType::deserialize(
-                        bytes_view(reinterpret_cast<bytes::value_type*>(data.get_write()), data.size()));
+                dest = VintType::deserialize_with_serialized_size(
+                        bytes_view(reinterpret_cast<bytes::value_type*>(data.get_write()), data.size()), len);
                 data.trim_front(len);
                 return read_status::ready;
             } else {
@@ -151,8 +151,8 @@ private:
         data.trim_front(n);
         _pos += n;
         if (_pos == _read_bytes_len) {
-            dest = VintType::deserialize(
-                    bytes_view(reinterpret_cast<bytes::value_type*>(_read_bytes.front().get_write()), _read_bytes_len));
+            dest = VintType::deserialize_with_serialized_size(
+                    bytes_view(reinterpret_cast<bytes::value_type*>(_read_bytes.front().get_write()), _read_bytes_len), _read_bytes_len);
             _prestate = prestate::NONE;
             return read_status::ready;
         }
@@ -218,6 +218,10 @@ public:
             return read_status::waiting;
         }
     }
+    // Borrows the value from the input stream: the produced fragments share
+    // the underlying (decompressed) chunk buffers and are only materialized
+    // into managed_bytes when the consumer builds cells. No byte of the value
+    // is copied on this path, even when it spans chunk boundaries.
     inline read_status read_bytes(temporary_buffer<char>& data, uint32_t len, fragmented_temporary_buffer& where) {
         if (data.size() >= len) {
             auto fragments = std::move(where).release();
@@ -267,8 +271,8 @@ public:
         } else {
             const vint_size_type len = unsigned_vint::serialized_size_from_first_byte(*data.begin());
             if (data.size() >= len) {
-                _u64 = unsigned_vint::deserialize(
-                    bytes_view(reinterpret_cast<bytes::value_type*>(data.get_write()), data.size()));
+                _u64 = unsigned_vint::deserialize_with_serialized_size(
+                    bytes_view(reinterpret_cast<bytes::value_type*>(data.get_write()), data.size()), len);
                 data.trim_front(len);
                 return read_bytes_contiguous(data, static_cast<uint32_t>(_u64), where);
             } else {
@@ -292,8 +296,8 @@ public:
         } else {
             const vint_size_type len = unsigned_vint::serialized_size_from_first_byte(*data.begin());
             if (data.size() >= len) {
-                _u64 = unsigned_vint::deserialize(
-                    bytes_view(reinterpret_cast<bytes::value_type*>(data.get_write()), data.size()));
+                _u64 = unsigned_vint::deserialize_with_serialized_size(
+                    bytes_view(reinterpret_cast<bytes::value_type*>(data.get_write()), data.size()), len);
                 data.trim_front(len);
                 return read_bytes(data, static_cast<uint32_t>(_u64), where);
             } else {
@@ -369,8 +373,8 @@ public:
             data.trim_front(n);
             _pos += n;
             if (_pos == _read_bytes_len) {
-                _u64 = unsigned_vint::deserialize(
-                        bytes_view(reinterpret_cast<bytes::value_type*>(_read_bytes.front().get_write()), _read_bytes_len));
+                _u64 = unsigned_vint::deserialize_with_serialized_size(
+                        bytes_view(reinterpret_cast<bytes::value_type*>(_read_bytes.front().get_write()), _read_bytes_len), _read_bytes_len);
                 if (read_bytes_contiguous(data, _u64, *_read_bytes_where_contiguous) == read_status::ready) {
                     _prestate = prestate::NONE;
                     return read_status::ready;
@@ -384,8 +388,8 @@ public:
             data.trim_front(n);
             _pos += n;
             if (_pos == _read_bytes_len) {
-                _u64 = unsigned_vint::deserialize(
-                        bytes_view(reinterpret_cast<bytes::value_type*>(_read_bytes.front().get_write()), _read_bytes_len));
+                _u64 = unsigned_vint::deserialize_with_serialized_size(
+                        bytes_view(reinterpret_cast<bytes::value_type*>(_read_bytes.front().get_write()), _read_bytes_len), _read_bytes_len);
                 if (read_bytes(data, _u64, *_read_bytes_where) == read_status::ready) {
                     _prestate = prestate::NONE;
                     return read_status::ready;
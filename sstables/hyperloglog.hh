@@ -89,6 +89,20 @@ static inline size_t write_unsigned_var_int(unsigned int value, uint8_t* to) {
     return size;
 }
 
+static inline unsigned int read_unsigned_var_int(const uint8_t*& from, const uint8_t* end) {
+    unsigned int value = 0;
+    unsigned shift = 0;
+    while (from != end && shift < 32) {
+        uint8_t byte = *from++;
+        value |= (unsigned int)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            return value;
+        }
+        shift += 7;
+    }
+    throw std::invalid_argument("truncated or overlong varint");
+}
+
 /** @class HyperLogLog
  *  @brief Implement of 'HyperLogLog' estimate cardinality algorithm
  */
@@ -128,11 +142,39 @@ public:
         alphaMM_ = alpha * m_ * m_;
     }
 
+    /**
+     * Reconstructs an estimator from the serialized form produced by
+     * get_bytes(), e.g. the cardinality blob in the sstable compaction
+     * metadata.
+     *
+     * @exception std::invalid_argument the buffer is truncated or holds an
+     *            unsupported version or representation (only the NORMAL,
+     *            non-sparse one is supported).
+     */
     static HyperLogLog from_bytes(temporary_buffer<uint8_t> bytes) {
-        // FIXME: implement class that creates a HyperLogLog from an array of bytes.
-        // This will useful if we need to work with the cardinality data from the
-        // compaction metadata.
-        abort();
+        const uint8_t* p = bytes.get();
+        const uint8_t* end = p + bytes.size();
+        if (size_t(end - p) < sizeof(int32_t)) {
+            throw std::invalid_argument("truncated cardinality metadata");
+        }
+        auto version = read_be<int32_t>(reinterpret_cast<const char*>(p));
+        p += sizeof(int32_t);
+        if (version != -2) {
+            throw std::invalid_argument("unsupported cardinality metadata version");
+        }
+        auto b = read_unsigned_var_int(p, end);
+        read_unsigned_var_int(p, end); // sparse precision, unused
+        auto type = read_unsigned_var_int(p, end);
+        if (type != 0) {
+            throw std::invalid_argument("only the NORMAL HyperLogLog representation is supported");
+        }
+        auto size = read_unsigned_var_int(p, end);
+        HyperLogLog hll(b);
+        if (size != hll.m_ || size_t(end - p) < size) {
+            throw std::invalid_argument("malformed cardinality metadata register set");
+        }
+        std::copy_n(p, size, hll.M_.begin());
+        return hll;
     }
 
     /**
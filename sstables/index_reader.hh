@@ -765,9 +765,18 @@ public:
         , _use_caching(caching)
         , _single_page_read(single_partition_read) // all entries for a given partition are within a single page
     {
+        ++_sstable->_index_reads;
+        ++_sstable->_active_index_readers;
         sstlog.trace("index {}: index_reader for {}", fmt::ptr(this), _sstable->get_filename());
     }
 
+    ~index_reader() {
+        // Moved-from readers have a null _sstable.
+        if (_sstable) {
+            --_sstable->_active_index_readers;
+        }
+    }
+
     // Ensures that partition_data_ready() returns true.
     // Can be called only when !eof()
     future<> read_partition_data() {
@@ -113,8 +113,8 @@ public:
     static constexpr double NO_COMPRESSION_RATIO = -1.0;
 
     static hll::HyperLogLog hyperloglog(int p, int sp) {
-        // FIXME: hll::HyperLogLog doesn't support sparse format, so ignoring parameters by the time being.
-        return hll::HyperLogLog();
+        // FIXME: hll::HyperLogLog doesn't support the sparse format, so sp is ignored.
+        return hll::HyperLogLog(p);
     }
 private:
     const schema& _schema;
@@ -169,6 +169,10 @@ public:
     cached_file::stream _stream;
     logalloc::allocating_section _as;
 private:
+    // Keeps speculative reads issued by prefetch_block_offset() alive.
+    // Waited for in close() so that no background read outlives the cursor.
+    future<> _prefetch_keepalive = make_ready_future<>();
+
     // Feeds the stream into the consumer until the consumer is satisfied.
     // Does not give unconsumed data back to the stream.
     template <typename Consumer>
@@ -345,6 +349,27 @@ public:
         erase_range(_blocks.begin(), _blocks.lower_bound(block->index));
     }
 
+    /// \brief Starts a speculative read of the offset-map page of the given block.
+    ///
+    /// A later get_block_*() for the block will then find the page already
+    /// cached (or the read in flight), hiding the I/O latency behind the
+    /// caller's other work. No-op if the block is already materialized.
+    void prefetch_block_offset(pi_index_type idx, tracing::trace_state_ptr trace_state) {
+        auto i = _blocks.lower_bound(idx);
+        if (i != _blocks.end() && i->index == idx) {
+            return;
+        }
+        auto f = _cached_file.prefetch(_promoted_index_start + get_offset_entry_pos(idx), _pc, std::move(trace_state));
+        if (!f.available()) {
+            _prefetch_keepalive = when_all(std::move(_prefetch_keepalive), std::move(f)).discard_result();
+        }
+    }
+
+    // Waits for outstanding speculative reads. Must resolve before destruction.
+    future<> close() noexcept {
+        return std::exchange(_prefetch_keepalive, make_ready_future<>());
+    }
+
     cached_file& file() { return _cached_file; }
 };
 
@@ -419,6 +444,16 @@ private:
             auto mid = _current_idx + (_upper_idx - _current_idx) / 2;
             tracing::trace(_trace_state, "mc_bsearch_clustered_cursor: bisecting range [{}, {}], mid={}", _current_idx, _upper_idx, mid);
             sstlog.trace("mc_bsearch_clustered_cursor {}: bisecting range [{}, {}], mid={}", fmt::ptr(this), _current_idx, _upper_idx, mid);
+            // Speculatively start reading the offset entries of both possible
+            // next probe positions, so the next bisection step finds its page
+            // cached (or at least in flight) instead of paying a blocking
+            // read per step.
+            if (mid > _current_idx) {
+                _promoted_index.prefetch_block_offset(_current_idx + (mid - _current_idx) / 2, _trace_state);
+            }
+            if (mid + 1 < _upper_idx) {
+                _promoted_index.prefetch_block_offset(mid + 1 + (_upper_idx - mid - 1) / 2, _trace_state);
+            }
             return _promoted_index.get_block_with_start(mid, _trace_state).then([this, mid, pos] (promoted_index_block* block) {
                 position_in_partition::less_compare less(_s);
                 sstlog.trace("mc_bsearch_clustered_cursor {}: compare with [{}] .start={}", fmt::ptr(this), mid, block->start);
@@ -568,7 +603,7 @@ public:
     }
 
     future<> close() noexcept override {
-        return make_ready_future<>();
+        return _promoted_index.close();
     }
 };
 
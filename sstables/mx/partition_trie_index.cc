@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) 2022-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: AGPL-3.0-or-later
+ */
+
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include <seastar/core/byteorder.hh>
+
+#include "sstables/mx/partition_trie_index.hh"
+
+namespace sstables {
+namespace mx {
+
+static constexpr uint8_t flag_has_payload = 0x01;
+static constexpr size_t child_entry_size = 1 + 2 + 4 + 4;
+
+void partition_trie_index::builder::add(bytes_view key, uint64_t payload) {
+    node* n = &_root;
+    size_t i = 0;
+    while (i < key.size()) {
+        auto b = uint8_t(key[i]);
+        auto it = n->children.find(b);
+        if (it == n->children.end()) {
+            auto leaf = std::make_unique<node>();
+            leaf->payload = payload;
+            n->children.emplace(b, child{bytes(key.begin() + i, key.end()), std::move(leaf)});
+            return;
+        }
+        const bytes& label = it->second.label;
+        size_t j = 0;
+        while (j < label.size() && i + j < key.size() && label[j] == key[i + j]) {
+            ++j;
+        }
+        if (j == label.size()) {
+            // The whole edge matches, descend.
+            n = it->second.n.get();
+            i += j;
+            continue;
+        }
+        // The edge matches only partially: split it at the divergence point.
+        auto intermediate = std::make_unique<node>();
+        bytes old_suffix = label.substr(j);
+        intermediate->children.emplace(uint8_t(old_suffix[0]), child{std::move(old_suffix), std::move(it->second.n)});
+        it->second.label = label.substr(0, j);
+        it->second.n = std::move(intermediate);
+        n = it->second.n.get();
+        i += j;
+        // The loop now either terminates with the payload on the
+        // intermediate node, or attaches the key's suffix as a fresh leaf.
+    }
+    n->payload = payload;
+}
+
+namespace {
+
+template <typename T>
+void append_le(std::vector<char>& out, T value) {
+    char buf[sizeof(T)];
+    seastar::write_le<T>(buf, value);
+    out.insert(out.end(), buf, buf + sizeof(T));
+}
+
+} // anonymous namespace
+
+bytes partition_trie_index::builder::build() && {
+    std::vector<char> out;
+    // Iterative post-order traversal: a node can only be serialized once the
+    // offsets of all its children are known. Recursion is avoided since trie
+    // depth is bounded only by key length.
+    struct frame {
+        node* n;
+        std::map<uint8_t, child>::iterator next;
+    };
+    std::unordered_map<const node*, uint32_t> offsets;
+    std::vector<frame> stack;
+    stack.push_back(frame{&_root, _root.children.begin()});
+    while (!stack.empty()) {
+        auto& f = stack.back();
+        if (f.next != f.n->children.end()) {
+            node* c = f.next->second.n.get();
+            ++f.next;
+            stack.push_back(frame{c, c->children.begin()});
+            continue;
+        }
+        // All children of f.n are serialized; emit the labels, then the node.
+        std::vector<uint32_t> label_offsets;
+        label_offsets.reserve(f.n->children.size());
+        for (const auto& [b, c] : f.n->children) {
+            label_offsets.push_back(out.size());
+            out.insert(out.end(), c.label.begin(), c.label.end());
+        }
+        if (out.size() + child_entry_size * f.n->children.size() > std::numeric_limits<uint32_t>::max()) {
+            throw std::overflow_error("partition_trie_index: serialized trie exceeds 4 GiB");
+        }
+        offsets[f.n] = out.size();
+        out.push_back(f.n->payload ? flag_has_payload : 0);
+        if (f.n->payload) {
+            append_le<uint64_t>(out, *f.n->payload);
+        }
+        append_le<uint16_t>(out, f.n->children.size());
+        size_t idx = 0;
+        for (const auto& [b, c] : f.n->children) {
+            out.push_back(b);
+            append_le<uint16_t>(out, c.label.size());
+            append_le<uint32_t>(out, label_offsets[idx++]);
+            append_le<uint32_t>(out, offsets[c.n.get()]);
+        }
+        stack.pop_back();
+    }
+    append_le<uint32_t>(out, offsets[&_root]);
+    return bytes(reinterpret_cast<const int8_t*>(out.data()), out.size());
+}
+
+std::optional<uint64_t> partition_trie_index::lookup(bytes_view key) const {
+    if (_data.size() < 4) {
+        return std::nullopt;
+    }
+    const char* base = reinterpret_cast<const char*>(_data.data());
+    uint32_t off = seastar::read_le<uint32_t>(base + _data.size() - 4);
+    size_t i = 0;
+    while (true) {
+        const char* p = base + off;
+        uint8_t flags = *p++;
+        uint64_t payload = 0;
+        if (flags & flag_has_payload) {
+            payload = seastar::read_le<uint64_t>(p);
+            p += sizeof(uint64_t);
+        }
+        if (i == key.size()) {
+            if (flags & flag_has_payload) {
+                return payload;
+            }
+            return std::nullopt;
+        }
+        auto n_children = seastar::read_le<uint16_t>(p);
+        p += sizeof(uint16_t);
+        // Binary search the fixed-stride child table for the next key byte.
+        auto b = uint8_t(key[i]);
+        const char* entry = nullptr;
+        size_t lo = 0, hi = n_children;
+        while (lo < hi) {
+            auto mid = (lo + hi) / 2;
+            const char* e = p + mid * child_entry_size;
+            auto first = uint8_t(*e);
+            if (first == b) {
+                entry = e;
+                break;
+            } else if (first < b) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        if (!entry) {
+            return std::nullopt;
+        }
+        auto label_len = seastar::read_le<uint16_t>(entry + 1);
+        auto label_off = seastar::read_le<uint32_t>(entry + 3);
+        auto child_off = seastar::read_le<uint32_t>(entry + 7);
+        if (i + label_len > key.size() || std::memcmp(base + label_off, key.data() + i, label_len) != 0) {
+            return std::nullopt;
+        }
+        i += label_len;
+        off = child_off;
+    }
+}
+
+} // namespace mx
+} // namespace sstables
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2022-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: AGPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <optional>
+
+#include "bytes.hh"
+
+namespace sstables {
+namespace mx {
+
+// A serialized byte-order trie over partition keys, BTI-style.
+//
+// The trie maps byte-comparable key strings to 64-bit payloads (positions in
+// Index.db or Data.db). Unlike the parsed-entry pages kept by
+// partition_index_cache, the serialized form is directly searchable: a lookup
+// walks the node headers of a flat buffer and binary-searches each node's
+// child table, without deserializing any entries. The buffer can therefore be
+// kept (or mapped) verbatim in memory with no parsed-representation
+// footprint.
+//
+// Edges are path-compressed: each child entry carries a byte-string label, so
+// long shared key prefixes cost one node, not one node per byte.
+//
+// Serialized layout (all integers little-endian, offsets absolute within the
+// buffer):
+//
+//   node := flags(1)            bit 0: node has a payload
+//           [payload(8)]        if bit 0 is set
+//           n_children(2)
+//           child_entry * n_children, sorted by first label byte:
+//               first_byte(1) label_len(2) label_off(4) child_off(4)
+//   file := nodes... root_off(4)
+//
+// The 32-bit offsets limit a single trie to 4 GiB of serialized form; tries
+// are expected to be built per sstable, far below that.
+class partition_trie_index {
+    bytes _data;
+public:
+    // Builds the in-memory trie and serializes it. Keys may be added in any
+    // order; they must be byte-comparable strings (for partition keys, the
+    // caller is responsible for applying a byte-comparable transform).
+    class builder {
+        struct node;
+        struct child {
+            bytes label;
+            std::unique_ptr<node> n;
+        };
+        struct node {
+            std::optional<uint64_t> payload;
+            // Keyed by the first byte of the edge label; first bytes of a
+            // node's edges are distinct by construction.
+            std::map<uint8_t, child> children;
+        };
+        node _root;
+    public:
+        // Associates the payload with the key. Adding the same key twice
+        // overwrites the payload.
+        void add(bytes_view key, uint64_t payload);
+        // Serializes the trie. The builder must not be used afterwards.
+        bytes build() &&;
+    };
+
+    // The data must have been produced by builder::build().
+    explicit partition_trie_index(bytes data) : _data(std::move(data)) {}
+
+    // Returns the payload associated with the key, or nullopt if the key is
+    // not present. Does not allocate.
+    std::optional<uint64_t> lookup(bytes_view key) const;
+
+    const bytes& data() const noexcept { return _data; }
+
+    size_t memory_size() const noexcept { return _data.size(); }
+};
+
+} // namespace mx
+} // namespace sstables
@@ -17,6 +17,8 @@
 #include "db/config.hh"
 #include "atomic_cell.hh"
 #include "utils/exceptions.hh"
+#include "utils/chunked_vector.hh"
+#include "utils/i_filter.hh"
 
 #include <functional>
 #include <boost/iterator/iterator_facade.hpp>
@@ -593,6 +595,12 @@ private:
     utils::UUID _run_identifier;
     bool _write_regular_as_static; // See #4139
     scylla_metadata::large_data_stats _large_data_stats;
+    // Key hashes of all partitions written so far. The bloom filter is built
+    // from these at seal time, when the exact partition count is known;
+    // sizing it from the a-priori estimate overshoots badly for compactions
+    // that expire most of the data. chunked_vector keeps the buffer free of
+    // large contiguous allocations.
+    utils::chunked_vector<utils::hashed_key> _filter_key_hashes;
 
     void init_file_writers();
 
@@ -791,7 +799,6 @@ public:
         _sst._shards = { shard };
 
         _cfg.monitor->on_write_started(_data_writer->offset_tracker());
-        _sst._components->filter = utils::i_filter::get_filter(estimated_partitions, _schema.bloom_filter_fp_chance(), utils::filter_format::m_format);
         _pi_write_m.promoted_index_block_size = cfg.promoted_index_block_size;
         _pi_write_m.promoted_index_auto_scale_threshold = cfg.promoted_index_auto_scale_threshold;
         _index_sampling_state.summary_byte_cost = _cfg.summary_byte_cost;
@@ -915,7 +922,7 @@ void writer::consume_new_partition(const dht::decorated_key& dk) {
     _partition_key = key::from_partition_key(_schema, dk.key());
     maybe_add_summary_entry(dk.token(), bytes_view(*_partition_key));
 
-    _sst._components->filter->add(bytes_view(*_partition_key));
+    _filter_key_hashes.push_back(utils::make_hashed_key(bytes_view(*_partition_key)));
     _collector.add_key(bytes_view(*_partition_key));
 
     auto p_key = disk_string_view<uint16_t>();
@@ -1426,6 +1433,14 @@ void writer::consume_end_of_stream() {
         _sst._schema->get_partitioner().name(), _schema.bloom_filter_fp_chance(),
         _sst._schema, _sst.get_first_decorated_key(), _sst.get_last_decorated_key(), _enc_stats);
     close_data_writer();
+    // Build the filter late, sized for the exact number of partitions
+    // written and the target false-positive rate.
+    _sst._components->filter = utils::i_filter::get_filter(std::max<uint64_t>(1, _filter_key_hashes.size()),
+            _schema.bloom_filter_fp_chance(), utils::filter_format::m_format);
+    for (const auto& hk : _filter_key_hashes) {
+        _sst._components->filter->add(hk);
+    }
+    _filter_key_hashes.clear();
     _sst.write_summary(_pc);
     _sst.write_filter(_pc);
     _sst.write_statistics(_pc);
@@ -38,6 +38,10 @@ private:
         key_type _key;
         std::variant<lw_shared_ptr<shared_promise<>>, partition_index_page> _page;
         size_t _size_in_allocator = 0;
+        // Set when the entry was referenced again after having been released
+        // to the LRU, i.e. its reuse is proven. Such entries are released to
+        // the protected LRU segment, see utils/lru.hh.
+        bool _promote = false;
     public:
         entry(partition_index_cache* parent, key_type key)
                 : _parent(parent)
@@ -111,6 +115,7 @@ public:
         explicit entry_ptr(lsa::weak_ptr<entry> ref)
             : _ref(std::move(ref))
         {
+            _ref->_promote |= _ref->is_linked();
             _ref->unlink_from_lru();
         }
         ~entry_ptr() { *this = nullptr; }
@@ -119,7 +124,11 @@ public:
         entry_ptr& operator=(std::nullptr_t) noexcept {
             if (_ref) {
                 if (_ref.unique()) {
-                    _ref->_parent->_lru.add(*_ref);
+                    if (_ref->_promote) {
+                        _ref->_parent->_lru.touch(*_ref);
+                    } else {
+                        _ref->_parent->_lru.add(*_ref);
+                    }
                 }
                 _ref = nullptr;
             }
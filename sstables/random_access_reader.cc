@@ -6,6 +6,7 @@
  * SPDX-License-Identifier: AGPL-3.0-or-later
  */
 
+#include <algorithm>
 #include <exception>
 
 #include "sstables/random_access_reader.hh"
@@ -54,7 +55,10 @@ input_stream<char> file_random_access_reader::open_at(uint64_t pos) {
     auto len = _file_size - pos;
     file_input_stream_options options;
     options.buffer_size = _buffer_size;
-    options.read_ahead = _read_ahead;
+    // Reads from here on are sequential until the next seek(), so scale the
+    // read-ahead with the remaining span, keeping the configured value as the
+    // floor for short tails.
+    options.read_ahead = std::max(_read_ahead, static_cast<unsigned>(std::min<uint64_t>(len / _buffer_size, 16)));
 
     return make_file_input_stream(_file, pos, len, std::move(options));
 }
@@ -90,12 +90,14 @@ std::vector<column_translation::column_info> column_translation::state::build(
         const schema& s,
         const utils::chunked_vector<serialization_header::column_desc>& src,
         const sstable_enabled_features& features,
-        bool is_static) {
+        bool is_static,
+        utils::chunked_vector<bytes>& name_storage) {
     std::vector<column_info> cols;
     if (s.is_dense()) {
         const column_definition& col = is_static ? *s.static_begin() : *s.regular_begin();
+        name_storage.push_back(col.name());
         cols.push_back(column_info{
-            &col.name(),
+            &name_storage.back(),
             col.type,
             col.id,
             col.type->value_length_if_fixed(),
@@ -121,8 +123,9 @@ std::vector<column_translation::column_info> column_translation::state::build(
                                   def->is_counter() != type->is_counter() ||
                                   !def->type->is_value_compatible_with(*type);
             }
+            name_storage.push_back(desc.name.value);
             cols.push_back(column_info{
-                &desc.name.value,
+                &name_storage.back(),
                 type,
                 id,
                 type->value_length_if_fixed(),
@@ -136,6 +139,24 @@ std::vector<column_translation::column_info> column_translation::state::build(
     return cols;
 }
 
+bool column_translation::state::equal_content(const state& o) const {
+    auto column_info_equal = [] (const column_info& a, const column_info& b) {
+        return *a.name == *b.name
+            && a.type->name() == b.type->name()
+            && a.id == b.id
+            && a.value_length == b.value_length
+            && a.is_collection == b.is_collection
+            && a.is_counter == b.is_counter
+            && a.schema_mismatch == b.schema_mismatch;
+    };
+    return schema_uuid == o.schema_uuid
+        && std::equal(regular_schema_columns_from_sstable.begin(), regular_schema_columns_from_sstable.end(),
+                      o.regular_schema_columns_from_sstable.begin(), o.regular_schema_columns_from_sstable.end(), column_info_equal)
+        && std::equal(static_schema_columns_from_sstable.begin(), static_schema_columns_from_sstable.end(),
+                      o.static_schema_columns_from_sstable.begin(), o.static_schema_columns_from_sstable.end(), column_info_equal)
+        && clustering_column_value_fix_lengths == o.clustering_column_value_fix_lengths;
+}
+
 
 
 position_in_partition_view get_slice_upper_bound(const schema& s, const query::partition_slice& slice, dht::ring_position_view key) {
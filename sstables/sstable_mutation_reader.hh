@@ -64,6 +64,10 @@ public:
     virtual void on_out_of_clustering_range() = 0;
 };
 
+// The value arrives as fragments borrowed from the decompressed input chunks
+// (see primitive_consumer::read_bytes); atomic_cell consumes the fragmented
+// view directly, so this is the only place the value bytes are copied -- into
+// the LSA-managed cell storage that the mutation model requires.
 inline atomic_cell make_atomic_cell(const abstract_type& type,
                                     api::timestamp_type timestamp,
                                     fragmented_temporary_buffer::view value,
@@ -715,8 +715,21 @@ make_pk_filter(const dht::ring_position& pos, const schema& schema) {
 // Filter out sstables for reader using bloom filter
 static std::vector<shared_sstable>
 filter_sstable_for_reader_by_pk(std::vector<shared_sstable>&& sstables, const schema& schema, const dht::ring_position& pos) {
-    auto filter = [_filter = make_pk_filter(pos, schema)] (const shared_sstable& sst) { return !_filter(*sst); };
-    sstables.erase(boost::remove_if(sstables, filter), sstables.end());
+    auto cmp = dht::ring_position_comparator(schema);
+    auto out_of_range = [&] (const shared_sstable& sst) {
+        return cmp(pos, sst->get_first_decorated_key()) < 0 || cmp(pos, sst->get_last_decorated_key()) > 0;
+    };
+    sstables.erase(boost::remove_if(sstables, out_of_range), sstables.end());
+    // Probe the surviving filters in two passes: hash the key once, start
+    // fetching every filter's blocks, then test. When a point read fans out
+    // over many sstables this overlaps the cache misses of the probes
+    // instead of taking them serially, one filter at a time.
+    auto hk = utils::make_hashed_key(static_cast<bytes_view>(key::from_partition_key(schema, *pos.key())));
+    for (const shared_sstable& sst : sstables) {
+        sst->filter_prefetch(hk);
+    }
+    auto absent = [&hk] (const shared_sstable& sst) { return !sst->filter_has_key(hk); };
+    sstables.erase(boost::remove_if(sstables, absent), sstables.end());
     return std::move(sstables);
 }
 
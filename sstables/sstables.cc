@@ -6,6 +6,7 @@
  * SPDX-License-Identifier: AGPL-3.0-or-later
  */
 
+#include <algorithm>
 #include "log.hh"
 #include <vector>
 #include <typeinfo>
@@ -1383,19 +1384,22 @@ future<> sstable::load(const io_priority_class& pc) noexcept {
         // read scylla-meta after toc. Might need it to parse
         // rest (hint extensions)
         return read_scylla_metadata(pc).then([this, &pc] {
-            // Read statistics ahead of others - if summary is missing
-            // we'll attempt to re-generate it and we need statistics for that
-            return read_statistics(pc).then([this, &pc] {
-                return seastar::when_all_succeed(
-                        read_compression(pc),
-                        read_filter(pc),
-                        read_summary(pc)).then_unpack([this] {
-                            validate_min_max_metadata();
-                            validate_max_local_deletion_time();
-                            validate_partitioner();
-                            return open_data();
-                        });
-            });
+            // Dispatch all remaining component reads in one wave instead of
+            // serializing them; with many small sstables the per-component
+            // I/O latencies dominate load time. The only ordering constraint
+            // left is summary after statistics, because a missing summary is
+            // regenerated and that needs statistics.
+            return seastar::when_all_succeed(
+                    read_compression(pc),
+                    read_filter(pc),
+                    read_statistics(pc).then([this, &pc] {
+                        return read_summary(pc);
+                    })).then_unpack([this] {
+                        validate_min_max_metadata();
+                        validate_max_local_deletion_time();
+                        validate_partitioner();
+                        return open_data();
+                    });
         });
     });
 }
@@ -1698,6 +1702,10 @@ future<> sstable::generate_summary(const io_priority_class& pc) {
     }
 
     sstlog.info("Summary file {} not found. Generating Summary...", filename(component_type::Summary));
+    _components->summary = co_await generate_summary_from_index(pc);
+}
+
+future<summary> sstable::generate_summary_from_index(const io_priority_class& pc) {
     class summary_generator {
         const dht::i_partitioner& _partitioner;
         summary& _summary;
@@ -1728,19 +1736,20 @@ future<> sstable::generate_summary(const io_priority_class& pc) {
     auto index_file = co_await new_sstable_component_file(_read_error_handler, component_type::Index, open_flags::ro);
     auto sem = reader_concurrency_semaphore(reader_concurrency_semaphore::no_limits{}, "sstables::generate_summary()");
 
+    summary new_summary;
     std::exception_ptr ex;
 
     try {
         auto index_size = co_await index_file.size();
         // an upper bound. Surely to be less than this.
         auto estimated_partitions = std::max<uint64_t>(index_size / sizeof(uint64_t), 1);
-        prepare_summary(_components->summary, estimated_partitions, _schema->min_index_interval());
+        prepare_summary(new_summary, estimated_partitions, _schema->min_index_interval());
 
         file_input_stream_options options;
         options.buffer_size = sstable_buffer_size;
         options.io_priority_class = pc;
 
-        auto s = summary_generator(_schema->get_partitioner(), _components->summary, _manager.config().sstable_summary_ratio());
+        auto s = summary_generator(_schema->get_partitioner(), new_summary, _manager.config().sstable_summary_ratio());
             auto ctx = make_lw_shared<index_consume_entry_context<summary_generator>>(
                     *this, sem.make_tracking_only_permit(_schema.get(), "generate-summary", db::no_timeout), s, trust_promoted_index::yes,
                     make_file_input_stream(index_file, 0, index_size, std::move(options)), 0, index_size,
@@ -1760,7 +1769,7 @@ future<> sstable::generate_summary(const io_priority_class& pc) {
             std::rethrow_exception(std::exchange(ex, {}));
         }
 
-        co_await seal_summary(_components->summary, std::move(s.first_key), std::move(s.last_key), s.state());
+        co_await seal_summary(new_summary, std::move(s.first_key), std::move(s.last_key), s.state());
     } catch (...) {
         ex = std::current_exception();
     }
@@ -1777,6 +1786,73 @@ future<> sstable::generate_summary(const io_priority_class& pc) {
     if (ex) {
         std::rethrow_exception(ex);
     }
+    co_return new_summary;
+}
+
+// Rebuilds the in-memory summary at new_sampling_level by dropping the
+// entries a summary written at that level would not contain (see
+// downsampling::get_original_indexes()), compacting the key storage in the
+// process. The on-disk Summary component is left untouched.
+future<> sstable::downsample_summary(int new_sampling_level) {
+    auto& cur = _components->summary;
+    new_sampling_level = std::max(new_sampling_level, 1);
+    if (!cur || new_sampling_level >= int(cur.header.sampling_level) || _active_index_readers) {
+        co_return;
+    }
+    const int current_level = cur.header.sampling_level;
+    // Entries repeat the original-index pattern every sampling_level entries,
+    // and the entries retained at a lower level are a subset of the ones
+    // retained at a higher one, so an entry survives iff its original index
+    // is still present at the new level.
+    const std::vector<int>& current_indexes = downsampling::get_original_indexes(current_level);
+    const std::vector<int>& new_indexes = downsampling::get_original_indexes(new_sampling_level);
+    std::vector<bool> keep(current_level);
+    for (int i = 0; i < current_level; i++) {
+        keep[i] = std::binary_search(new_indexes.begin(), new_indexes.end(), current_indexes[i]);
+    }
+
+    summary s;
+    s.header.min_index_interval = cur.header.min_index_interval;
+    s.header.sampling_level = new_sampling_level;
+    s.header.size_at_full_sampling = cur.header.size_at_full_sampling;
+    s.first_key = cur.first_key;
+    s.last_key = cur.last_key;
+    for (size_t i = 0; i < cur.entries.size(); i++) {
+        if (keep[i % current_level]) {
+            auto& e = cur.entries[i];
+            s.add_summary_data(e.token.data());
+            auto key_data = s.add_summary_data(e.key);
+            s.entries.push_back({ e.token, key_data, e.position });
+        }
+        co_await coroutine::maybe_yield();
+    }
+    s.header.size = s.entries.size();
+    s.header.memory_size = s.header.size * sizeof(uint32_t);
+    s.positions.reserve(s.entries.size());
+    for (auto& e : s.entries) {
+        s.positions.push_back(s.header.memory_size);
+        s.header.memory_size += e.key.size() + sizeof(e.position);
+        co_await coroutine::maybe_yield();
+    }
+    if (_active_index_readers) {
+        // A reader started while we were rebuilding and holds indexes into
+        // the current entry layout, so drop the rebuilt copy instead.
+        co_return;
+    }
+    _components->summary = std::move(s);
+}
+
+future<> sstable::upsample_summary(const io_priority_class& pc) {
+    if (!_components->summary
+            || int(_components->summary.header.sampling_level) >= downsampling::BASE_SAMPLING_LEVEL
+            || _active_index_readers) {
+        co_return;
+    }
+    auto s = co_await generate_summary_from_index(pc);
+    if (_active_index_readers) {
+        co_return;
+    }
+    _components->summary = std::move(s);
 }
 
 bool sstable::is_shared() const {
@@ -2296,7 +2372,12 @@ input_stream<char> sstable::data_stream(uint64_t pos, size_t len, const io_prior
     file_input_stream_options options;
     options.buffer_size = sstable_buffer_size;
     options.io_priority_class = pc;
-    options.read_ahead = 4;
+    // The default read-ahead suits point reads. When the caller opens a long
+    // span (range scans, streaming, compaction input), ramp the read-ahead up
+    // proportionally to the span so the drive sees enough overlapped
+    // sequential reads to approach its bandwidth. dynamic_adjustments (when
+    // provided) still scales it back down if the consumer seeks around.
+    options.read_ahead = std::clamp<unsigned>(len / sstable_buffer_size, 4, 16);
     options.dynamic_adjustments = std::move(history);
 
     file f = make_tracked_file(_data_file, std::move(permit));
@@ -2555,6 +2636,17 @@ double sstable::get_compression_ratio() const {
     }
 }
 
+column_translation sstable::get_column_translation(
+        const schema& s, const serialization_header& h, const sstable_enabled_features& f) {
+    if (!_column_translation.matches(s.version())) {
+        // Fetch the state from the manager's intern cache, so generations of
+        // the same table share one copy of the mapping instead of each
+        // building its own.
+        _column_translation = _manager.get_column_translation(s, h, f);
+    }
+    return _column_translation;
+}
+
 void sstable::set_sstable_level(uint32_t new_level) {
     auto entry = _components->statistics.contents.find(metadata_type::Stats);
     if (entry == _components->statistics.contents.end()) {
@@ -3265,6 +3357,7 @@ std::ostream& operator<<(std::ostream& out, const sstables::component_type& comp
     case ct::TemporaryTOC: out << "TemporaryTOC"; break;
     case ct::TemporaryStatistics: out << "TemporaryStatistics"; break;
     case ct::Scylla: out << "Scylla"; break;
+    case ct::Dictionary: out << "Dictionary"; break;
     case ct::Unknown: out << "Unknown"; break;
     }
     return out;
@@ -528,6 +528,14 @@ private:
     sstables_manager& _manager;
 
     sstables_stats _stats;
+
+    // Index readers created over this sstable so far; sampled by
+    // sstables_manager::resample_summaries() to tell hot sstables from cold.
+    uint64_t _index_reads = 0;
+    uint64_t _index_reads_at_last_resample = 0;
+    // Live index readers. While nonzero the summary must not be replaced,
+    // since readers keep indexes into the current entry layout.
+    unsigned _active_index_readers = 0;
     manager_link_type _manager_link;
 
     // The _large_data_stats map stores e.g. largest partitions, rows, cells sizes,
@@ -590,6 +598,9 @@ private:
     // happen if old tools are being used.
     future<> generate_summary(const io_priority_class& pc);
 
+    // Builds a summary at full sampling by scanning the Index component.
+    future<summary> generate_summary_from_index(const io_priority_class& pc);
+
     future<> read_statistics(const io_priority_class& pc);
     void write_statistics(const io_priority_class& pc);
     // Rewrite statistics component by creating a temporary Statistics and
@@ -728,6 +739,13 @@ public:
         return _components->filter->is_present(key);
     }
 
+    // Starts bringing the filter blocks probed by filter_has_key() into
+    // cache. Used to batch the memory stalls of probing many sstables'
+    // filters with the same key.
+    void filter_prefetch(utils::hashed_key key) const {
+        _components->filter->prefetch(key);
+    }
+
     bool filter_has_key(const schema& s, partition_key_view key) const {
         return filter_has_key(key::from_partition_key(s, key));
     }
@@ -784,9 +802,7 @@ public:
         return get_mutable_serialization_header(*_components);
     }
     column_translation get_column_translation(
-            const schema& s, const serialization_header& h, const sstable_enabled_features& f) {
-        return _column_translation.get_for_schema(s, h, f);
-    }
+            const schema& s, const serialization_header& h, const sstable_enabled_features& f);
     const std::vector<unsigned>& get_shards_for_this_sstable() const {
         return _shards;
     }
@@ -814,6 +830,18 @@ public:
         return _components->summary;
     }
 
+    // Replaces the in-memory summary with one downsampled to the given
+    // sampling level, freeing most of the memory it uses. In-memory only:
+    // the on-disk Summary component is left as written, so reloading the
+    // sstable recovers the original resolution. No-op if the new level is
+    // not lower than the current one or if index readers are active.
+    future<> downsample_summary(int new_sampling_level);
+
+    // Rebuilds the summary from the Index component at full sampling,
+    // undoing earlier downsampling. The rebuilt summary is thrown away if
+    // index readers showed up while it was being generated.
+    future<> upsample_summary(const io_priority_class& pc);
+
     // Gets ratio of droppable tombstone. A tombstone is considered droppable here
     // for cells expired before gc_before and regular tombstones older than gc_before.
     double estimate_droppable_tombstone_ratio(gc_clock::time_point gc_before) const;
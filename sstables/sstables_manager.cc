@@ -10,10 +10,15 @@
 #include "sstables/sstables_manager.hh"
 #include "sstables/partition_index_cache.hh"
 #include "sstables/sstables.hh"
+#include "sstables/downsampling.hh"
 #include "db/config.hh"
 #include "gms/feature.hh"
 #include "gms/feature_service.hh"
 
+#include <seastar/core/coroutine.hh>
+#include <seastar/core/memory.hh>
+#include <seastar/core/smp.hh>
+
 namespace sstables {
 
 logging::logger smlogger("sstables_manager");
@@ -21,6 +26,18 @@ logging::logger smlogger("sstables_manager");
 sstables_manager::sstables_manager(
     db::large_data_handler& large_data_handler, const db::config& dbcfg, gms::feature_service& feat, cache_tracker& ct)
     : _large_data_handler(large_data_handler), _db_config(dbcfg), _features(feat), _cache_tracker(ct) {
+    if (int32_t interval = _db_config.index_summary_resize_interval_in_minutes(); interval > 0) {
+        _summary_resample_timer.set_callback([this] {
+            // Chain the rounds so a slow one is never run concurrently with
+            // the next.
+            _summary_resample_done = _summary_resample_done.then([this] {
+                return resample_summaries();
+            }).handle_exception([] (std::exception_ptr ex) {
+                smlogger.warn("Index summary resampling failed: {}", ex);
+            });
+        });
+        _summary_resample_timer.arm_periodic(std::chrono::minutes(interval));
+    }
 }
 
 sstables_manager::~sstables_manager() {
@@ -44,6 +61,23 @@ shared_sstable sstables_manager::make_sstable(schema_ptr schema,
     return make_lw_shared<sstable>(std::move(schema), std::move(dir), generation, v, f, get_large_data_handler(), *this, now, std::move(error_handler_gen), buffer_size);
 }
 
+column_translation sstables_manager::get_column_translation(const schema& s, const serialization_header& h, const sstable_enabled_features& f) {
+    auto built = column_translation().get_for_schema(s, h, f);
+    auto [begin, end] = _column_translation_cache.equal_range(s.version());
+    for (auto it = begin; it != end; ++it) {
+        if (it->second.same_translation(built)) {
+            return it->second;
+        }
+    }
+    // Drop entries no sstable references anymore before caching a new one,
+    // so translations of dropped tables and old schema versions don't pile up.
+    if (_column_translation_cache.size() >= _column_translation_cache_gc_threshold) {
+        std::erase_if(_column_translation_cache, [] (const auto& e) { return e.second.state_unshared(); });
+    }
+    _column_translation_cache.emplace(s.version(), built);
+    return built;
+}
+
 sstable_writer_config sstables_manager::configure_writer(sstring origin) const {
     sstable_writer_config cfg;
 
@@ -93,8 +127,92 @@ void sstables_manager::maybe_done() {
 
 future<> sstables_manager::close() {
     _closing = true;
+    _summary_resample_timer.cancel();
     maybe_done();
-    return _done.get_future();
+    // A resampling round in progress holds references to sstables, so wait
+    // for it before waiting for the sstables themselves.
+    return std::exchange(_summary_resample_done, make_ready_future<>()).then([this] {
+        return _done.get_future();
+    });
+}
+
+future<> sstables_manager::resample_summaries() {
+    if (_closing) {
+        co_return;
+    }
+    // The configured capacity is for the whole node, like in origin; each
+    // shard takes care of its own share. By default allow the summaries 5%
+    // of shard memory.
+    uint64_t capacity = uint64_t(_db_config.index_summary_capacity_in_mb()) * 1024 * 1024 / smp::count;
+    if (capacity == 0) {
+        capacity = memory::stats().total_memory() / 20;
+    }
+    struct candidate {
+        shared_sstable sst;
+        uint64_t reads;
+    };
+    std::vector<candidate> candidates;
+    uint64_t total = 0;
+    for (sstable& sst : _active) {
+        if (!sst.get_summary()) {
+            continue;
+        }
+        auto reads = sst._index_reads - sst._index_reads_at_last_resample;
+        sst._index_reads_at_last_resample = sst._index_reads;
+        total += sst.get_summary().memory_footprint();
+        candidates.push_back(candidate{sst.shared_from_this(), reads});
+    }
+    smlogger.debug("resample_summaries: {} summaries using {} bytes, capacity {} bytes", candidates.size(), total, capacity);
+    if (total > capacity) {
+        // Over budget: shrink the summaries of the coldest sstables first.
+        // Halving the resolution rather than dropping straight to the
+        // minimum keeps the penalty small if an sstable turns hot again.
+        std::sort(candidates.begin(), candidates.end(), [] (const candidate& a, const candidate& b) {
+            return a.reads < b.reads;
+        });
+        for (auto& c : candidates) {
+            if (total <= capacity || _closing) {
+                break;
+            }
+            auto before = c.sst->get_summary().memory_footprint();
+            co_await c.sst->downsample_summary(c.sst->get_summary().header.sampling_level / 2);
+            auto after = c.sst->get_summary().memory_footprint();
+            if (after != before) {
+                smlogger.debug("Downsampled summary of {} to level {}, freeing {} bytes",
+                        c.sst->get_filename(), c.sst->get_summary().header.sampling_level, before - after);
+            }
+            total -= before - after;
+        }
+    } else {
+        // Under budget: restore resolution where it is actually useful.
+        // Upsampling costs a scan of the Index component, so do it hottest
+        // first, only for sstables which were read since the last round,
+        // and only while the result is projected to stay within budget.
+        std::sort(candidates.begin(), candidates.end(), [] (const candidate& a, const candidate& b) {
+            return a.reads > b.reads;
+        });
+        for (auto& c : candidates) {
+            if (_closing) {
+                break;
+            }
+            const summary& s = c.sst->get_summary();
+            if (!c.reads || int(s.header.sampling_level) >= downsampling::BASE_SAMPLING_LEVEL) {
+                continue;
+            }
+            auto before = s.memory_footprint();
+            auto projected = before * downsampling::BASE_SAMPLING_LEVEL / std::max<uint64_t>(s.header.sampling_level, 1);
+            if (total - before + projected > capacity) {
+                continue;
+            }
+            co_await c.sst->upsample_summary(default_priority_class());
+            auto after = c.sst->get_summary().memory_footprint();
+            if (after != before) {
+                smlogger.debug("Upsampled summary of {} back to level {}",
+                        c.sst->get_filename(), c.sst->get_summary().header.sampling_level);
+            }
+            total += after - before;
+        }
+    }
 }
 
 }   // namespace sstables
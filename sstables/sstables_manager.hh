@@ -11,6 +11,8 @@
 
 #include <seastar/core/shared_ptr.hh>
 #include <seastar/core/sharded.hh>
+#include <seastar/core/timer.hh>
+#include <seastar/core/lowres_clock.hh>
 
 #include "utils/disk-error-handler.hh"
 #include "gc_clock.hh"
@@ -65,6 +67,16 @@ private:
     bool _closing = false;
     promise<> _done;
     cache_tracker& _cache_tracker;
+
+    // Periodic index summary resampling; see resample_summaries().
+    timer<lowres_clock> _summary_resample_timer;
+    future<> _summary_resample_done = make_ready_future<>();
+
+    // Interned column_translation states, keyed by schema version. Entries
+    // no longer referenced by any sstable are dropped once the cache grows
+    // past _column_translation_cache_gc_threshold.
+    static constexpr size_t _column_translation_cache_gc_threshold = 128;
+    std::unordered_multimap<utils::UUID, column_translation> _column_translation_cache;
 public:
     explicit sstables_manager(db::large_data_handler& large_data_handler, const db::config& dbcfg, gms::feature_service& feat, cache_tracker&);
     virtual ~sstables_manager();
@@ -83,6 +95,12 @@ public:
     const db::config& config() const { return _db_config; }
     cache_tracker& get_cache_tracker() { return _cache_tracker; }
 
+    // Returns a column_translation for the given schema/header pair, interned
+    // across sstables: all generations of a table whose headers translate
+    // identically under the schema share one state instead of each keeping
+    // its own copy of the column mapping.
+    column_translation get_column_translation(const schema& s, const serialization_header& h, const sstable_enabled_features& f);
+
     void set_format(sstable_version_types format) noexcept { _format = format; }
     sstables::sstable::version_types get_highest_supported_format() const noexcept { return _format; }
 
@@ -105,6 +123,10 @@ private:
     void deactivate(sstable* sst);
     void remove(sstable* sst);
     void maybe_done();
+    // Redistributes the memory spent on index summaries according to how
+    // much each sstable is actually read; runs periodically off
+    // _summary_resample_timer.
+    future<> resample_summaries();
 private:
     db::large_data_handler& get_large_data_handler() const {
         return _large_data_handler;
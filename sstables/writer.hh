@@ -10,6 +10,7 @@
 
 #include <seastar/core/iostream.hh>
 #include <seastar/core/fstream.hh>
+#include <seastar/core/loop.hh>
 #include "types.hh"
 #include "checksum_utils.hh"
 #include "progress_monitor.hh"
@@ -152,7 +153,49 @@ public:
     virtual temporary_buffer<char> allocate_buffer(size_t size) override {
         return _out.allocate_buffer(size); // preserve alignment requirements
     }
-    virtual future<> put(net::packet data) override { abort(); }
+    virtual future<> put(net::packet data) override {
+        // Checksum the fragment chain without coalescing it: per-chunk
+        // checksums are carried across fragment boundaries, and each
+        // fragment is forwarded to the underlying sink as-is. As in the
+        // contiguous path, each put() is assumed to start on a chunk
+        // boundary.
+        auto bufs = data.release();
+        size_t chunk_remaining = 0;
+        uint32_t per_chunk_checksum = 0;
+        auto close_chunk = [this, &per_chunk_checksum] (size_t chunk_len) {
+            if constexpr (ChecksumType::prefer_combine()) {
+                _full_checksum = ChecksumType::checksum_combine(_full_checksum, per_chunk_checksum, chunk_len);
+            }
+            _c.checksums.push_back(per_chunk_checksum);
+        };
+        for (auto& buf : bufs) {
+            for (size_t offset = 0; offset < buf.size();) {
+                if (!chunk_remaining) {
+                    chunk_remaining = _c.chunk_size;
+                    per_chunk_checksum = ChecksumType::init_checksum();
+                }
+                size_t size = std::min(size_t(chunk_remaining), buf.size() - offset);
+                per_chunk_checksum = ChecksumType::checksum(per_chunk_checksum, buf.begin() + offset, size);
+                if constexpr (!ChecksumType::prefer_combine()) {
+                    _full_checksum = ChecksumType::checksum(_full_checksum, buf.begin() + offset, size);
+                }
+                chunk_remaining -= size;
+                offset += size;
+                if (!chunk_remaining) {
+                    close_chunk(_c.chunk_size);
+                }
+            }
+        }
+        if (chunk_remaining) {
+            // Trailing partial chunk (final flush).
+            close_chunk(_c.chunk_size - chunk_remaining);
+        }
+        return do_with(std::move(bufs), [this] (auto& bufs) {
+            return do_for_each(bufs, [this] (temporary_buffer<char>& buf) {
+                return _out.put(std::move(buf));
+            });
+        });
+    }
     virtual future<> put(temporary_buffer<char> buf) override {
         // bufs will usually be a multiple of chunk size, but this won't be the case for
         // the last buffer being flushed.
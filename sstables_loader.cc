@@ -7,6 +7,8 @@
  */
 
 #include <seastar/core/coroutine.hh>
+#include <seastar/core/queue.hh>
+#include <seastar/core/semaphore.hh>
 #include <seastar/coroutine/parallel_for_each.hh>
 #include <seastar/rpc/rpc.hh>
 #include "sstables_loader.hh"
@@ -27,14 +29,43 @@ static logging::logger llog("sstables_loader");
 namespace {
 
 class send_meta_data {
+    // A fragment waiting behind a slow target. The semaphore units bound the
+    // memory queued per target.
+    struct queued_fragment {
+        frozen_mutation_fragment fmf;
+        bool is_partition_start;
+        semaphore_units<> memory;
+    };
+    static constexpr size_t queue_memory_budget = 1 * 1024 * 1024;
     gms::inet_address _node;
     seastar::rpc::sink<frozen_mutation_fragment, streaming::stream_mutation_fragments_cmd> _sink;
     seastar::rpc::source<int32_t> _source;
     bool _error_from_peer = false;
     size_t _num_partitions_sent = 0;
     size_t _num_bytes_sent = 0;
+    seastar::semaphore _queue_memory{queue_memory_budget};
+    seastar::queue<std::optional<queued_fragment>> _queue{1024};
+    future<> _send_done;
     future<> _receive_done;
 private:
+    future<> do_send() {
+        try {
+            while (auto qf = co_await _queue.pop_eventually()) {
+                if (qf->is_partition_start) {
+                    ++_num_partitions_sent;
+                }
+                auto size = qf->fmf.representation().size();
+                _num_bytes_sent += size;
+                llog.trace("send_meta_data: send mf to node={}, size={}", _node, size);
+                co_await _sink(qf->fmf, streaming::stream_mutation_fragments_cmd::mutation_fragment_data);
+            }
+        } catch (...) {
+            // Wake up a producer blocked on a full queue.
+            _queue.abort(std::current_exception());
+            throw;
+        }
+        llog.debug("send_meta_data: finished sending to node={}", _node);
+    }
     future<> do_receive() {
         int32_t status = 0;
         while (auto status_opt = co_await _source()) {
@@ -57,25 +88,41 @@ public:
         : _node(std::move(node))
         , _sink(std::move(sink))
         , _source(std::move(source))
+        , _send_done(make_ready_future<>())
         , _receive_done(make_ready_future<>()) {
     }
-    void receive() {
+    void start() {
+        _send_done = do_send();
         _receive_done = do_receive();
     }
-    future<> send(const frozen_mutation_fragment& fmf, bool is_partition_start) {
+    // Queues the fragment for this target and returns as soon as there is
+    // room, so one slow or congested target does not stall the producing
+    // reader and the other targets; the actual send happens on this target's
+    // sender fiber, in order.
+    future<> send(frozen_mutation_fragment fmf, bool is_partition_start) {
         if (_error_from_peer) {
             throw std::runtime_error(format("send_meta_data: got error from peer node={}", _node));
         }
         auto size = fmf.representation().size();
-        if (is_partition_start) {
-            ++_num_partitions_sent;
-        }
-        _num_bytes_sent += size;
-        llog.trace("send_meta_data: send mf to node={}, size={}", _node, size);
-        co_return co_await _sink(fmf, streaming::stream_mutation_fragments_cmd::mutation_fragment_data);
+        // Clamped so a fragment larger than the whole budget can still pass.
+        auto memory = co_await get_units(_queue_memory, std::min(size, queue_memory_budget));
+        co_await _queue.push_eventually(queued_fragment{std::move(fmf), is_partition_start, std::move(memory)});
     }
     future<> finish(bool failed) {
         std::exception_ptr eptr;
+        try {
+            co_await _queue.push_eventually(std::nullopt);
+        } catch (...) {
+            // The queue was aborted by a failed sender fiber; the error is
+            // reported below, when _send_done resolves.
+        }
+        try {
+            co_await std::move(_send_done);
+        } catch (...) {
+            eptr = std::current_exception();
+            failed = true;
+            llog.warn("send_meta_data: failed to send queued fragments to node={}, err={}", _node, eptr);
+        }
         try {
             if (failed) {
                 co_await _sink(frozen_mutation_fragment(bytes_ostream()), streaming::stream_mutation_fragments_cmd::error);
@@ -176,7 +223,7 @@ future<> sstables_loader::load_and_stream(sstring ks_name, sstring cf_name,
                                     ops_uuid, cf_id, estimated_partitions, reason, netw::messaging_service::msg_addr(node));
                             llog.debug("load_and_stream: ops_uuid={}, make sink and source for node={}", ops_uuid, node);
                             metas.emplace(node, send_meta_data(node, std::move(sink), std::move(source)));
-                            metas.at(node).receive();
+                            metas.at(node).start();
                         }
                     }
                 }
@@ -60,7 +60,11 @@ std::function<future<> (flat_mutation_reader_v2)> make_streaming_consumer(sstrin
                                              encoding_stats{}, pc).then([sst] {
                     return sst->open_data();
                 }).then([cf, sst, offstrategy, reason, origin] {
-                    if (offstrategy && sstables::repair_origin == origin) {
+                    if (offstrategy) {
+                        // Arm the quiescence timer regardless of origin, so
+                        // maintenance sstables get promoted eventually even
+                        // for operations that have no explicit completion
+                        // notification (e.g. rebuild, removenode).
                         sstables::sstlog.debug("Enabled automatic off-strategy trigger for table {}.{}",
                                 cf->schema()->ks_name(), cf->schema()->cf_name());
                         cf->enable_off_strategy_trigger();
@@ -45,6 +45,9 @@ static sstables::offstrategy is_offstrategy_supported(streaming::stream_reason r
     static const std::unordered_set<streaming::stream_reason> operations_supported = {
         streaming::stream_reason::bootstrap,
         streaming::stream_reason::replace,
+        streaming::stream_reason::removenode,
+        streaming::stream_reason::decommission,
+        streaming::stream_reason::rebuild,
     };
     return sstables::offstrategy(operations_supported.contains(reason));
 }
@@ -129,8 +132,13 @@ void stream_manager::init_messaging_service_handler() {
             // Close the sink in case the table is dropped.
             auto op = _db.local().find_column_family(cf_id).stream_in_progress();
             //FIXME: discarded future.
+            auto reader = make_generating_reader_v1(s, permit, std::move(get_next_mutation_fragment));
+            // Pull fragments off the rpc source in batches larger than the
+            // default buffer size, so that distributing a batch across shards
+            // overlaps with the network delivering the next one.
+            reader.set_max_buffer_size(128 * 1024);
             (void)mutation_writer::distribute_reader_and_consume_on_shards(s,
-                make_generating_reader_v1(s, permit, std::move(get_next_mutation_fragment)),
+                std::move(reader),
                 make_streaming_consumer("streaming", _db, _sys_dist_ks, _view_update_generator, estimated_partitions, reason, is_offstrategy_supported(reason)),
                 std::move(op)
             ).then_wrapped([s, plan_id, from, sink, estimated_partitions] (future<uint64_t> f) mutable {
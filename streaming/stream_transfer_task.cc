@@ -43,6 +43,12 @@ stream_transfer_task::stream_transfer_task(shared_ptr<stream_session> session, U
 
 stream_transfer_task::~stream_transfer_task() = default;
 
+// The default reader buffer size is tuned for interactive queries which
+// usually read a small amount of data. Streaming moves entire token ranges,
+// so use a larger buffer to amortize the cost of refilling it and to keep
+// the rpc sink fed while the next batch is read from disk.
+static constexpr size_t stream_reader_buffer_size = 128 * 1024;
+
 struct send_info {
     netw::messaging_service& ms;
     utils::UUID plan_id;
@@ -73,6 +79,7 @@ struct send_info {
         , reader(cf.make_streaming_reader(cf.schema(), std::move(permit_), prs))
         , update(std::move(update_fn))
     {
+        reader.set_max_buffer_size(stream_reader_buffer_size);
     }
     future<bool> has_relevant_range_on_this_shard() {
         return do_with(false, ranges.begin(), [this] (bool& found_relevant_range, dht::token_range_vector::iterator& ranges_it) {
@@ -272,3 +272,32 @@ SEASTAR_TEST_CASE(test_minmax_on_set) {
         }
     });
 }
+
+// Exercises the fast path for a sole min()/max() over the first clustering
+// column, which reads towards the sought end of each partition and lets each
+// partition contribute a single row (see select_statement's constructor).
+SEASTAR_TEST_CASE(test_minmax_of_first_clustering_column) {
+    return do_with_cql_env_thread([&] (auto& e) {
+        for (auto [table, order] : {std::pair("ts_asc", "ASC"), std::pair("ts_desc", "DESC")}) {
+            e.execute_cql(format("CREATE TABLE {} (pk int, ck int, v int, PRIMARY KEY (pk, ck)) WITH CLUSTERING ORDER BY (ck {})", table, order)).get();
+            for (int pk = 0; pk < 2; ++pk) {
+                for (int ck = 0; ck < 10; ++ck) {
+                    e.execute_cql(format("INSERT INTO {} (pk, ck, v) VALUES ({}, {}, {})", table, pk, ck, ck)).get();
+                }
+            }
+            // The row tombstone must make the read fall back to the next live row.
+            e.execute_cql(format("DELETE FROM {} WHERE pk = 1 AND ck = 9", table)).get();
+
+            auto require_single_value = [&] (const sstring& query, int expected) {
+                auto msg = e.execute_cql(query).get0();
+                assert_that(msg).is_rows().with_size(1).with_row({{int32_type->decompose(expected)}});
+            };
+            require_single_value(format("SELECT max(ck) FROM {} WHERE pk = 0", table), 9);
+            require_single_value(format("SELECT min(ck) FROM {} WHERE pk = 0", table), 0);
+            require_single_value(format("SELECT max(ck) FROM {} WHERE pk = 1", table), 8);
+            require_single_value(format("SELECT max(ck) FROM {}", table), 9);
+            require_single_value(format("SELECT max(ck) FROM {} WHERE pk = 0 AND ck < 5", table), 4);
+            require_single_value(format("SELECT min(ck) FROM {} WHERE pk = 1 AND ck > 3", table), 4);
+        }
+    });
+}
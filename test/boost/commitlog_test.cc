@@ -412,6 +412,42 @@ SEASTAR_TEST_CASE(test_commitlog_reader){
         });
 }
 
+SEASTAR_TEST_CASE(test_commitlog_compressed_reader){
+    commitlog::config cfg;
+    cfg.commitlog_segment_size_in_mb = 1;
+    cfg.use_compression = true;
+    return cl_test(cfg, [](commitlog& log) -> future<> {
+        auto uuid = utils::UUID_gen::get_time_UUID();
+        sstring tmp = "hej bubba cow";
+        rp_set set;
+        size_t n = 1000;
+        for (size_t i = 0; i < n; ++i) {
+            auto h = co_await log.add_mutation(uuid, tmp.size(), db::commitlog::force_sync::no, [tmp](db::commitlog::output& dst) {
+                dst.write(tmp.data(), tmp.size());
+            });
+            BOOST_CHECK_NE(db::replay_position(), h.rp());
+            set.put(std::move(h));
+        }
+        co_await log.sync_all_segments();
+        size_t count = 0;
+        for (auto& seg : log.get_active_segment_names()) {
+            // all segments must have been written in the compressed format
+            commitlog::descriptor desc(seg, db::commitlog::descriptor::FILENAME_PREFIX);
+            BOOST_CHECK_GE(desc.ver, commitlog::descriptor::segment_version_3);
+            co_await db::commitlog::read_log_file(seg, db::commitlog::descriptor::FILENAME_PREFIX, service::get_local_commitlog_priority(), [&count](db::commitlog::buffer_and_replay_position buf_rp) {
+                auto&& [buf, rp] = buf_rp;
+                auto linearization_buffer = bytes_ostream();
+                auto in = buf.get_istream();
+                auto str = to_sstring_view(in.read_bytes_view(buf.size_bytes(), linearization_buffer));
+                BOOST_CHECK_EQUAL(str, "hej bubba cow");
+                ++count;
+                return make_ready_future<>();
+            });
+        }
+        BOOST_CHECK_EQUAL(count, n);
+    });
+}
+
 static future<> corrupt_segment(sstring seg, uint64_t off, uint32_t value) {
     return open_file_dma(seg, open_flags::rw).then([off, value](file f) {
         size_t size = align_up<size_t>(off, 4096);
@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2022-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: AGPL-3.0-or-later
+ */
+
+#include <seastar/core/sleep.hh>
+#include <seastar/testing/thread_test_case.hh>
+
+#include "utils/hot_partition_sketch.hh"
+
+using namespace std::chrono_literals;
+
+SEASTAR_THREAD_TEST_CASE(test_hot_partition_sketch_estimates) {
+    utils::hot_partition_sketch sketch(1024, 1h);
+
+    BOOST_REQUIRE_EQUAL(sketch.current_max(), 0);
+
+    // One hot key among many cold ones. The estimate for the hot key must
+    // not undercount and the cold keys must not be inflated anywhere near
+    // the hot key's count.
+    const uint64_t hot_key = 0xdeadbeef;
+    uint32_t hot_estimate = 0;
+    for (int i = 0; i < 1000; ++i) {
+        hot_estimate = sketch.record(hot_key);
+        sketch.record(i);
+    }
+    BOOST_REQUIRE_GE(hot_estimate, 1000);
+    BOOST_REQUIRE_GE(sketch.current_max(), 1000);
+
+    auto cold_estimate = sketch.record(12345);
+    BOOST_REQUIRE_LT(cold_estimate, 100);
+}
+
+SEASTAR_THREAD_TEST_CASE(test_hot_partition_sketch_weighted_record) {
+    utils::hot_partition_sketch sketch(1024, 1h);
+
+    // Weighted records accumulate the weight rather than the event count,
+    // and the counters saturate instead of wrapping around.
+    const uint64_t key = 0xdeadbeef;
+    BOOST_REQUIRE_GE(sketch.record(key, 4096), 4096);
+    BOOST_REQUIRE_GE(sketch.record(key, 4096), 8192);
+
+    auto estimate = sketch.record(key, std::numeric_limits<uint32_t>::max());
+    BOOST_REQUIRE_EQUAL(estimate, std::numeric_limits<uint32_t>::max());
+    BOOST_REQUIRE_EQUAL(sketch.record(key, 1), std::numeric_limits<uint32_t>::max());
+}
+
+SEASTAR_THREAD_TEST_CASE(test_hot_partition_sketch_decay) {
+    utils::hot_partition_sketch sketch(1024, 100ms);
+
+    const uint64_t hot_key = 0xdeadbeef;
+    for (int i = 0; i < 1000; ++i) {
+        sketch.record(hot_key);
+    }
+    const auto before_decay = sketch.current_max();
+    BOOST_REQUIRE_GE(before_decay, 1000);
+
+    seastar::sleep(200ms).get();
+
+    // The next record triggers the decay, halving the counters at least once.
+    const auto estimate = sketch.record(hot_key);
+    BOOST_REQUIRE_LT(estimate, before_decay);
+    BOOST_REQUIRE_LT(sketch.current_max(), before_decay);
+}
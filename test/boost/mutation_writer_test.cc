@@ -7,6 +7,7 @@
  */
 
 
+#include <seastar/core/sleep.hh>
 #include <seastar/core/thread.hh>
 #include <seastar/testing/test_case.hh>
 #include <seastar/testing/thread_test_case.hh>
@@ -25,6 +26,7 @@
 #include "test/lib/mutation_assertions.hh"
 #include "test/lib/random_utils.hh"
 #include "test/lib/random_schema.hh"
+#include "test/lib/simple_schema.hh"
 #include "test/lib/log.hh"
 
 #include <boost/range/adaptor/map.hpp>
@@ -171,6 +173,78 @@ SEASTAR_TEST_CASE(test_multishard_writer_producer_aborts) {
     });
 }
 
+// Reproducer for the multishard writer stalling on a single slow shard:
+// the consumer on one shard sits on its first partition until every other
+// shard received all of its partitions. Distribution can only make that
+// progress by reading ahead of the stalled shard's queue.
+SEASTAR_TEST_CASE(test_multishard_writer_slow_shard) {
+    return do_with_cql_env_thread([] (cql_test_env& e) {
+        if (smp::count < 2) {
+            return; // needs a shard to be slow while another makes progress
+        }
+        simple_schema ss;
+        schema_ptr s = ss.schema();
+
+        std::vector<mutation> muts;
+        for (uint32_t i = 0; i < 100; i++) {
+            mutation m(s, ss.make_pkey(i));
+            ss.add_row(m, ss.make_ckey(0), "v");
+            muts.push_back(std::move(m));
+        }
+        std::sort(muts.begin(), muts.end(), [&] (const mutation& a, const mutation& b) {
+            return a.decorated_key().less_compare(*s, b.decorated_key());
+        });
+
+        std::vector<size_t> shards_before(smp::count, 0);
+        std::vector<size_t> shards_after(smp::count, 0);
+        for (auto& m : muts) {
+            shards_before[s->get_sharder().shard_of(m.token())]++;
+        }
+        const unsigned slow_shard = s->get_sharder().shard_of(muts.front().token());
+
+        auto source_reader = make_flat_mutation_reader_from_mutations_v2(s, make_reader_permit(e), muts);
+        auto close_source_reader = deferred_close(source_reader);
+        size_t partitions_received = distribute_reader_and_consume_on_shards(s,
+            std::move(source_reader),
+            [&shards_before, &shards_after, slow_shard] (flat_mutation_reader_v2 reader) {
+                return with_closeable(std::move(reader), [&shards_before, &shards_after, slow_shard] (flat_mutation_reader_v2& reader) {
+                    return repeat([&shards_before, &shards_after, slow_shard, &reader] {
+                        return reader().then([&shards_before, &shards_after, slow_shard] (mutation_fragment_v2_opt mf_opt) -> future<stop_iteration> {
+                            if (!mf_opt) {
+                                return make_ready_future<stop_iteration>(stop_iteration::yes);
+                            }
+                            if (!mf_opt->is_partition_start()) {
+                                return make_ready_future<stop_iteration>(stop_iteration::no);
+                            }
+                            auto shard = this_shard_id();
+                            if (shard == slow_shard && !shards_after[shard]) {
+                                auto others_done = [&shards_before, &shards_after, slow_shard] {
+                                    for (unsigned i = 0; i < smp::count; i++) {
+                                        if (i != slow_shard && shards_after[i] != shards_before[i]) {
+                                            return false;
+                                        }
+                                    }
+                                    return true;
+                                };
+                                return do_until(others_done, [] {
+                                    return seastar::sleep(std::chrono::milliseconds(1));
+                                }).then([&shards_after, shard] {
+                                    shards_after[shard]++;
+                                    return stop_iteration::no;
+                                });
+                            }
+                            shards_after[shard]++;
+                            return make_ready_future<stop_iteration>(stop_iteration::no);
+                        });
+                    });
+                });
+            }
+        ).get0();
+        BOOST_REQUIRE_EQUAL(partitions_received, muts.size());
+        BOOST_REQUIRE_EQUAL(shards_after, shards_before);
+    });
+}
+
 namespace {
 
 class test_bucket_writer {
@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2022-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: AGPL-3.0-or-later
+ */
+
+#define BOOST_TEST_MODULE core
+
+#include <boost/test/included/unit_test.hpp>
+#include <map>
+#include <random>
+
+#include "sstables/mx/partition_trie_index.hh"
+
+using sstables::mx::partition_trie_index;
+
+static bytes b(const char* s) {
+    return bytes(reinterpret_cast<const int8_t*>(s), strlen(s));
+}
+
+BOOST_AUTO_TEST_CASE(test_empty_trie) {
+    auto idx = partition_trie_index(partition_trie_index::builder().build());
+    BOOST_REQUIRE(!idx.lookup(b("")));
+    BOOST_REQUIRE(!idx.lookup(b("key")));
+}
+
+BOOST_AUTO_TEST_CASE(test_basic_lookup) {
+    partition_trie_index::builder bld;
+    bld.add(b("apple"), 1);
+    bld.add(b("apricot"), 2);
+    bld.add(b("banana"), 3);
+    bld.add(b("app"), 4);
+    auto idx = partition_trie_index(std::move(bld).build());
+    BOOST_REQUIRE_EQUAL(*idx.lookup(b("apple")), 1);
+    BOOST_REQUIRE_EQUAL(*idx.lookup(b("apricot")), 2);
+    BOOST_REQUIRE_EQUAL(*idx.lookup(b("banana")), 3);
+    BOOST_REQUIRE_EQUAL(*idx.lookup(b("app")), 4);
+    BOOST_REQUIRE(!idx.lookup(b("ap")));
+    BOOST_REQUIRE(!idx.lookup(b("apples")));
+    BOOST_REQUIRE(!idx.lookup(b("cherry")));
+    BOOST_REQUIRE(!idx.lookup(b("")));
+}
+
+BOOST_AUTO_TEST_CASE(test_empty_key_and_overwrite) {
+    partition_trie_index::builder bld;
+    bld.add(b(""), 7);
+    bld.add(b("x"), 8);
+    bld.add(b("x"), 9);
+    auto idx = partition_trie_index(std::move(bld).build());
+    BOOST_REQUIRE_EQUAL(*idx.lookup(b("")), 7);
+    BOOST_REQUIRE_EQUAL(*idx.lookup(b("x")), 9);
+}
+
+BOOST_AUTO_TEST_CASE(test_full_byte_range) {
+    auto make_key = [] (unsigned i) {
+        bytes key(bytes::initialized_later(), 2);
+        key[0] = int8_t(i);
+        key[1] = int8_t(255 - i);
+        return key;
+    };
+    partition_trie_index::builder bld;
+    for (unsigned i = 0; i < 256; ++i) {
+        bld.add(make_key(i), i);
+    }
+    auto idx = partition_trie_index(std::move(bld).build());
+    for (unsigned i = 0; i < 256; ++i) {
+        auto key = make_key(i);
+        BOOST_REQUIRE_EQUAL(*idx.lookup(key), i);
+        BOOST_REQUIRE(!idx.lookup(bytes_view(key.data(), 1)));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_random_keys) {
+    auto rand = std::default_random_engine();
+    auto len_dist = std::uniform_int_distribution<size_t>(1, 32);
+    auto byte_dist = std::uniform_int_distribution<int>(0, 255);
+    std::map<bytes, uint64_t> reference;
+    partition_trie_index::builder bld;
+    for (int i = 0; i < 10000; ++i) {
+        bytes key(bytes::initialized_later(), len_dist(rand));
+        for (auto& c : key) {
+            c = int8_t(byte_dist(rand));
+        }
+        reference[key] = i;
+        bld.add(key, i);
+    }
+    auto idx = partition_trie_index(std::move(bld).build());
+    for (const auto& [key, payload] : reference) {
+        BOOST_REQUIRE_EQUAL(*idx.lookup(key), payload);
+    }
+    for (int i = 0; i < 10000; ++i) {
+        bytes key(bytes::initialized_later(), len_dist(rand));
+        for (auto& c : key) {
+            c = int8_t(byte_dist(rand));
+        }
+        auto it = reference.find(key);
+        auto res = idx.lookup(key);
+        if (it == reference.end()) {
+            BOOST_REQUIRE(!res);
+        } else {
+            BOOST_REQUIRE_EQUAL(*res, it->second);
+        }
+    }
+}
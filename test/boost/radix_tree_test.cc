@@ -11,6 +11,8 @@
 #include <seastar/testing/test_case.hh>
 #include <seastar/testing/thread_test_case.hh>
 #include <fmt/core.h>
+#include <random>
+#include <set>
 
 #include "utils/compact-radix-tree.hh"
 
@@ -116,6 +118,34 @@ BOOST_AUTO_TEST_CASE(test_lower_bound) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(test_lower_bound_sparse) {
+    // Sparse keys keep nodes in indirect layouts, exercising the
+    // vectorized successor search over the node index arrays.
+    test_tree tree;
+    std::set<unsigned> keys;
+
+    std::default_random_engine eng(0x12345);
+    std::uniform_int_distribution<unsigned> dist(0, 299999);
+
+    for (int i = 0; i < 100; i++) {
+        unsigned key = dist(eng);
+        if (keys.insert(key).second) {
+            tree.emplace(key, key);
+        }
+    }
+
+    for (unsigned i = 0; i < 300001; i++) {
+        test_data* d = tree.lower_bound(i);
+        auto ref = keys.lower_bound(i);
+        if (ref == keys.end()) {
+            BOOST_REQUIRE(d == nullptr);
+        } else {
+            BOOST_REQUIRE(d != nullptr);
+            BOOST_REQUIRE(d->value() == *ref);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(test_clear) {
     test_tree tree;
 
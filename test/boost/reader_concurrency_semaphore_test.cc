@@ -707,6 +707,8 @@ SEASTAR_THREAD_TEST_CASE(test_reader_concurrency_semaphore_admission) {
         const auto stats_after = semaphore.get_stats();
         BOOST_REQUIRE_EQUAL(stats_after.reads_admitted, stats_before.reads_admitted + 1);
         BOOST_REQUIRE_EQUAL(stats_after.reads_enqueued, stats_before.reads_enqueued);
+        // Admitted on the fast path, so no admission wait is recorded.
+        BOOST_REQUIRE_EQUAL(stats_after.estimated_admission_wait.count(), stats_before.estimated_admission_wait.count());
     }
     BOOST_REQUIRE_EQUAL(semaphore.available_resources(), initial_resources);
     require_can_admit(true, "semaphore in initial state");
@@ -774,6 +776,8 @@ SEASTAR_THREAD_TEST_CASE(test_reader_concurrency_semaphore_admission) {
             permit2_fut.ignore_ready_future();
             BOOST_FAIL("Enqueued permit didn't get admitted as expected");
         }
+
+        BOOST_REQUIRE_EQUAL(semaphore.get_stats().estimated_admission_wait.count(), stats_before.estimated_admission_wait.count() + 1);
     };
 
     // admitting enqueued reads -- permit owning resources destroyed
@@ -837,6 +841,40 @@ SEASTAR_THREAD_TEST_CASE(test_reader_concurrency_semaphore_admission) {
     require_can_admit(true, "semaphore in initial state");
 }
 
+SEASTAR_THREAD_TEST_CASE(test_reader_concurrency_semaphore_predicted_memory_admission) {
+    simple_schema s;
+    const auto schema_ptr = s.schema().get();
+    const auto initial_resources = reader_concurrency_semaphore::resources{10, 10 * 1024};
+    reader_concurrency_semaphore semaphore(reader_concurrency_semaphore::for_tests{}, get_name(), initial_resources.count, initial_resources.memory);
+    auto stop_sem = deferred_stop(semaphore);
+
+    BOOST_REQUIRE_EQUAL(semaphore.get_stats().read_excess_memory_ewma, 0);
+
+    // Run a batch of reads consuming well beyond their base resources to
+    // train the admission estimate.
+    for (int i = 0; i < 32; ++i) {
+        auto permit = semaphore.obtain_permit(schema_ptr, get_name(), 1024, db::no_timeout).get0();
+        auto units = permit.consume_memory(4 * 1024);
+    }
+    const auto ewma = semaphore.get_stats().read_excess_memory_ewma;
+    BOOST_REQUIRE(ewma > 2 * 1024);
+
+    // Hold one permit so the no-active-reads admission special case doesn't
+    // apply, then leave just short of base + estimate memory available: a
+    // read whose base resources alone would fit must not be admitted.
+    auto permit = semaphore.obtain_permit(schema_ptr, get_name(), 1024, db::no_timeout).get0();
+    const auto consumed = reader_resources::with_memory(semaphore.available_resources().memory - ssize_t(1024 + ewma) + 1);
+    semaphore.consume(consumed);
+    BOOST_REQUIRE(semaphore.available_resources().memory >= 1024);
+    auto fail_fut = semaphore.obtain_permit(schema_ptr, get_name(), 1024, db::timeout_clock::now());
+    fail_fut.wait();
+    BOOST_REQUIRE_THROW(std::rethrow_exception(fail_fut.get_exception()), semaphore_timed_out);
+
+    // With the estimate covered again, admission proceeds.
+    semaphore.signal(consumed);
+    auto admitted_permit = semaphore.obtain_permit(schema_ptr, get_name(), 1024, db::timeout_clock::now()).get0();
+}
+
 SEASTAR_THREAD_TEST_CASE(test_reader_concurrency_semaphore_used_blocked) {
     const auto initial_resources = reader_concurrency_semaphore::resources{2, 2 * 1024};
     reader_concurrency_semaphore semaphore(reader_concurrency_semaphore::for_tests{}, get_name(), initial_resources.count, initial_resources.memory);
@@ -15,6 +15,7 @@
 #include "sstables/sstables.hh"
 #include "sstables/key.hh"
 #include "sstables/compress.hh"
+#include "sstables/downsampling.hh"
 #include <seastar/testing/test_case.hh>
 #include <seastar/testing/thread_test_case.hh>
 #include "schema.hh"
@@ -2595,6 +2596,77 @@ SEASTAR_TEST_CASE(summary_rebuild_sanity) {
     });
 }
 
+SEASTAR_TEST_CASE(summary_resample_sanity) {
+    return test_env::do_with_async([] (test_env& env) {
+        auto builder = schema_builder("tests", "test")
+                .with_column("id", utf8_type, column_kind::partition_key)
+                .with_column("value", utf8_type);
+        builder.set_compressor_params(compression_parameters::no_compression());
+        auto s = builder.build(schema_builder::compact_storage::no);
+        const column_definition& col = *s->get_column_definition("value");
+
+        auto make_insert = [&] (partition_key key) {
+            mutation m(s, key);
+            m.set_clustered_cell(clustering_key::make_empty(), col, make_atomic_cell(utf8_type, bytes(1024, 'a')));
+            return m;
+        };
+
+        std::vector<mutation> mutations;
+        for (auto i = 0; i < s->min_index_interval()*4; i++) {
+            auto key = to_bytes("key" + to_sstring(i));
+            mutations.push_back(make_insert(partition_key::from_exploded(*s, {std::move(key)})));
+        }
+
+        auto tmp = tmpdir();
+        auto sst_gen = [&env, s, &tmp, gen = make_lw_shared<unsigned>(1)] () mutable {
+            return env.make_sstable(s, tmp.path().string(), (*gen)++, sstables::get_highest_sstable_version(), big);
+        };
+        auto sst = make_sstable_containing(sst_gen, mutations);
+        sst = env.reusable_sst(s, tmp.path().string(), 1).get0();
+
+        const auto full_size = sst->get_summary().entries.size();
+        const auto size_at_full_sampling = sst->get_summary().header.size_at_full_sampling;
+        const auto first_key = sst->get_summary().first_key.value;
+        const auto last_key = sst->get_summary().last_key.value;
+        BOOST_REQUIRE(full_size > 1);
+        BOOST_REQUIRE_EQUAL(sst->get_summary().header.sampling_level, downsampling::BASE_SAMPLING_LEVEL);
+
+        sst->downsample_summary(downsampling::BASE_SAMPLING_LEVEL / 2).get();
+        const summary& down = sst->get_summary();
+        BOOST_REQUIRE_EQUAL(down.header.sampling_level, downsampling::BASE_SAMPLING_LEVEL / 2);
+        BOOST_REQUIRE(down.entries.size() < full_size);
+        BOOST_REQUIRE_EQUAL(down.header.size, down.entries.size());
+        BOOST_REQUIRE_EQUAL(down.header.size_at_full_sampling, size_at_full_sampling);
+        BOOST_REQUIRE(down.first_key.value == first_key);
+        BOOST_REQUIRE(down.last_key.value == last_key);
+
+        // All partitions must still be readable through the coarser summary.
+        // Scoped so no index reader is left alive to block the upsampling below.
+        {
+            std::set<mutation, mutation_decorated_key_less_comparator> merged;
+            merged.insert(mutations.begin(), mutations.end());
+            auto rd = assert_that(sst->as_mutation_source().make_reader_v2(s, env.make_reader_permit(), query::full_partition_range));
+            for (auto&& m : merged) {
+                rd.produces(m);
+            }
+            rd.produces_end_of_stream();
+
+            auto r = dht::partition_range::make_singular(mutations.back().decorated_key());
+            assert_that(sst->as_mutation_source().make_reader_v2(s, env.make_reader_permit(), r))
+                .produces(slice(mutations, r))
+                .produces_end_of_stream();
+        }
+
+        // Upsampling rebuilds the original summary from the index.
+        sst->upsample_summary(default_priority_class()).get();
+        const summary& up = sst->get_summary();
+        BOOST_REQUIRE_EQUAL(up.header.sampling_level, downsampling::BASE_SAMPLING_LEVEL);
+        BOOST_REQUIRE_EQUAL(up.entries.size(), full_size);
+        BOOST_REQUIRE(up.first_key.value == first_key);
+        BOOST_REQUIRE(up.last_key.value == last_key);
+    });
+}
+
 SEASTAR_TEST_CASE(sstable_partition_estimation_sanity_test) {
     return test_env::do_with_async([] (test_env& env) {
         auto builder = schema_builder("tests", "test")
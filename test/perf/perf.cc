@@ -12,11 +12,32 @@
 #include "seastarx.hh"
 #include "reader_concurrency_semaphore.hh"
 
+#include <linux/perf_event.h>
+
 
 uint64_t perf_mallocs() {
     return memory::stats().mallocs();
 }
 
+static linux_perf_event user_hw_counter(uint64_t config) {
+    ::perf_event_attr attr = {};
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return linux_perf_event(attr, 0, -1, -1, 0);
+}
+
+linux_perf_event user_cpu_cycles_retired_counter() {
+    return user_hw_counter(PERF_COUNT_HW_CPU_CYCLES);
+}
+
+linux_perf_event user_cache_misses_counter() {
+    return user_hw_counter(PERF_COUNT_HW_CACHE_MISSES);
+}
+
 uint64_t perf_tasks_processed() {
     return engine().get_sched_stats().tasks_processed;
 }
@@ -49,8 +70,23 @@ std::ostream& operator<<(std::ostream& out, const scheduling_latency_measurer& s
 
 std::ostream&
 operator<<(std::ostream& os, const perf_result& result) {
-    fmt::print(os, "{:.2f} tps ({:5.1f} allocs/op, {:5.1f} tasks/op, {:7.0f} insns/op)",
-            result.throughput, result.mallocs_per_op, result.tasks_per_op, result.instructions_per_op);
+    fmt::print(os, "{:.2f} tps ({:5.1f} allocs/op, {:5.1f} tasks/op, {:7.0f} insns/op, {:7.0f} cycles/op, {:5.1f} cache misses/op)",
+            result.throughput, result.mallocs_per_op, result.tasks_per_op, result.instructions_per_op,
+            result.cpu_cycles_per_op, result.cache_misses_per_op);
+    return os;
+}
+
+std::ostream&
+operator<<(std::ostream& os, const perf_latency_result& result) {
+    auto to_ms = [] (int64_t nanos) {
+        return float(nanos) / 1e6;
+    };
+    fmt::print(os, "{:.2f} tps ({:5.1f} allocs/op, {:5.1f} tasks/op, {:7.0f} insns/op, {:7.0f} cycles/op, p50 {:.3f} [ms], p95 {:.3f} [ms], p99 {:.3f} [ms], max {:.3f} [ms])",
+            result.throughput, result.mallocs_per_op, result.tasks_per_op, result.instructions_per_op, result.cpu_cycles_per_op,
+            to_ms(result.latencies.percentile(0.5)),
+            to_ms(result.latencies.percentile(0.95)),
+            to_ms(result.latencies.percentile(0.99)),
+            to_ms(result.latencies.max()));
     return os;
 }
 
@@ -11,7 +11,11 @@
 #include <seastar/core/print.hh>
 #include <seastar/core/future-util.hh>
 #include <seastar/core/distributed.hh>
+#include <seastar/core/gate.hh>
+#include <seastar/core/sleep.hh>
+#include <seastar/core/thread.hh>
 #include <seastar/core/weak_ptr.hh>
+#include <seastar/testing/test_runner.hh>
 #include "seastarx.hh"
 #include "utils/extremum_tracking.hh"
 #include "utils/estimated_histogram.hh"
@@ -20,6 +24,7 @@
 
 #include <chrono>
 #include <iosfwd>
+#include <random>
 #include <boost/range/irange.hpp>
 
 template <typename Func>
@@ -50,6 +55,8 @@ struct executor_shard_stats {
     uint64_t allocations = 0;
     uint64_t tasks_executed = 0;
     uint64_t instructions_retired = 0;
+    uint64_t cpu_cycles_retired = 0;
+    uint64_t cache_misses = 0;
 };
 
 inline
@@ -59,6 +66,8 @@ operator+(executor_shard_stats a, executor_shard_stats b) {
     a.allocations += b.allocations;
     a.tasks_executed += b.tasks_executed;
     a.instructions_retired += b.instructions_retired;
+    a.cpu_cycles_retired += b.cpu_cycles_retired;
+    a.cache_misses += b.cache_misses;
     return a;
 }
 
@@ -69,12 +78,20 @@ operator-(executor_shard_stats a, executor_shard_stats b) {
     a.allocations -= b.allocations;
     a.tasks_executed -= b.tasks_executed;
     a.instructions_retired -= b.instructions_retired;
+    a.cpu_cycles_retired -= b.cpu_cycles_retired;
+    a.cache_misses -= b.cache_misses;
     return a;
 }
 
 uint64_t perf_tasks_processed();
 uint64_t perf_mallocs();
 
+// Userspace-only hardware counters for the measured region, in the spirit of
+// linux_perf_event::user_instructions_retired(). They read as 0 when the PMU
+// is unavailable (e.g. in a VM without vPMU).
+linux_perf_event user_cpu_cycles_retired_counter();
+linux_perf_event user_cache_misses_counter();
+
 // Drives concurrent and continuous execution of given asynchronous action
 // until a deadline. Counts invocations and collects statistics.
 template <typename Func>
@@ -85,6 +102,8 @@ class executor {
     const unsigned _n_workers;
     uint64_t _count;
     linux_perf_event _instructions_retired_counter = linux_perf_event::user_instructions_retired();
+    linux_perf_event _cpu_cycles_retired_counter = user_cpu_cycles_retired_counter();
+    linux_perf_event _cache_misses_counter = user_cache_misses_counter();
 private:
     executor_shard_stats executor_shard_stats_snapshot();
     future<> run_worker() {
@@ -108,11 +127,15 @@ public:
     future<executor_shard_stats> run() {
         auto stats_start = executor_shard_stats_snapshot();
         _instructions_retired_counter.enable();
+        _cpu_cycles_retired_counter.enable();
+        _cache_misses_counter.enable();
         auto idx = boost::irange(0, (int)_n_workers);
         return parallel_for_each(idx.begin(), idx.end(), [this] (auto idx) mutable {
             return this->run_worker();
         }).then([this, stats_start] {
             _instructions_retired_counter.disable();
+            _cpu_cycles_retired_counter.disable();
+            _cache_misses_counter.disable();
             auto stats_end = executor_shard_stats_snapshot();
             return stats_end - stats_start;
         });
@@ -131,6 +154,8 @@ executor<Func>::executor_shard_stats_snapshot() {
         .allocations = perf_mallocs(),
         .tasks_executed = perf_tasks_processed(),
         .instructions_retired = _instructions_retired_counter.read(),
+        .cpu_cycles_retired = _cpu_cycles_retired_counter.read(),
+        .cache_misses = _cache_misses_counter.read(),
     };
 }
 
@@ -139,6 +164,8 @@ struct perf_result {
     double mallocs_per_op;
     double tasks_per_op;
     double instructions_per_op;
+    double cpu_cycles_per_op;
+    double cache_misses_per_op;
 };
 
 std::ostream& operator<<(std::ostream& os, const perf_result& result);
@@ -190,6 +217,8 @@ std::vector<Res> time_parallel_ex(Func func, unsigned concurrency_per_core, int
         result.mallocs_per_op = double(stats.allocations) / stats.invocations;
         result.tasks_per_op = double(stats.tasks_executed) / stats.invocations;
         result.instructions_per_op = double(stats.instructions_retired) / stats.invocations;
+        result.cpu_cycles_per_op = double(stats.cpu_cycles_retired) / stats.invocations;
+        result.cache_misses_per_op = double(stats.cache_misses) / stats.invocations;
 
         uf(result, stats);
 
@@ -206,6 +235,187 @@ std::vector<perf_result> time_parallel(Func func, unsigned concurrency_per_core,
     return time_parallel_ex<perf_result>(std::move(func), concurrency_per_core, iterations, operations_per_shard);
 }
 
+struct perf_latency_result : public perf_result {
+    utils::estimated_histogram latencies{300}; // in nanoseconds
+};
+
+std::ostream& operator<<(std::ostream& os, const perf_latency_result& result);
+
+struct open_loop_shard_result {
+    executor_shard_stats stats;
+    utils::estimated_histogram latencies{300};
+};
+
+inline
+open_loop_shard_result
+operator+(open_loop_shard_result a, const open_loop_shard_result& b) {
+    a.stats = a.stats + b.stats;
+    a.latencies.merge(b.latencies);
+    return a;
+}
+
+// Drives execution of given asynchronous action with Poisson arrivals at a
+// fixed rate (open loop), unlike executor which issues the next operation
+// only when a worker becomes free (closed loop). Latency of each operation
+// is measured from its scheduled arrival time rather than from the moment it
+// was actually issued, so time spent queued behind slow operations is charged
+// to the operations themselves and the reported distribution does not suffer
+// from coordinated omission.
+template <typename Func>
+class open_loop_executor {
+    using clk = std::chrono::steady_clock;
+    const Func _func;
+    const clk::time_point _end_at;
+    std::exponential_distribution<double> _interarrival;
+    gate _gate;
+    utils::estimated_histogram _latencies{300};
+    uint64_t _count = 0;
+    std::exception_ptr _error;
+    linux_perf_event _instructions_retired_counter = linux_perf_event::user_instructions_retired();
+    linux_perf_event _cpu_cycles_retired_counter = user_cpu_cycles_retired_counter();
+    linux_perf_event _cache_misses_counter = user_cache_misses_counter();
+private:
+    executor_shard_stats executor_shard_stats_snapshot() {
+        return executor_shard_stats{
+            .invocations = _count,
+            .allocations = perf_mallocs(),
+            .tasks_executed = perf_tasks_processed(),
+            .instructions_retired = _instructions_retired_counter.read(),
+            .cpu_cycles_retired = _cpu_cycles_retired_counter.read(),
+            .cache_misses = _cache_misses_counter.read(),
+        };
+    }
+public:
+    // rate is in operations per second, per shard.
+    open_loop_executor(double rate, Func func, clk::time_point end_at)
+            : _func(std::move(func))
+            , _end_at(end_at)
+            , _interarrival(rate)
+    { }
+
+    future<open_loop_shard_result> run() {
+        return seastar::async([this] {
+            auto stats_start = executor_shard_stats_snapshot();
+            _instructions_retired_counter.enable();
+            _cpu_cycles_retired_counter.enable();
+            _cache_misses_counter.enable();
+            auto next = clk::now();
+            while (next < _end_at && !_error) {
+                auto now = clk::now();
+                if (next > now) {
+                    seastar::sleep(next - now).get();
+                }
+                // If we fell behind the schedule, issue all overdue
+                // operations without sleeping in between.
+                ++_count;
+                (void)with_gate(_gate, [this, scheduled = next] {
+                    return _func().then_wrapped([this, scheduled] (future<> f) {
+                        if (f.failed()) {
+                            _error = f.get_exception();
+                        } else {
+                            _latencies.add((clk::now() - scheduled).count());
+                        }
+                    });
+                });
+                auto pause = std::chrono::duration<double>(_interarrival(seastar::testing::local_random_engine));
+                next += std::chrono::duration_cast<clk::duration>(pause);
+            }
+            _gate.close().get();
+            if (_error) {
+                std::rethrow_exception(_error);
+            }
+            _instructions_retired_counter.disable();
+            _cpu_cycles_retired_counter.disable();
+            _cache_misses_counter.disable();
+            auto stats = executor_shard_stats_snapshot() - stats_start;
+            return open_loop_shard_result{std::move(stats), std::move(_latencies)};
+        });
+    }
+
+    future<> stop() {
+        return make_ready_future<>();
+    }
+};
+
+/**
+ * Open-loop counterpart of time_parallel(). Instead of a fixed number of
+ * workers issuing operations back-to-back, operations arrive as a Poisson
+ * process at the given total rate (operations per second), spread evenly
+ * across all cores.
+ *
+ * Runs many iterations. Prints the achieved throughput and the latency
+ * distribution after each iteration.
+ *
+ * Returns one result per iteration, carrying the full latency histogram.
+ */
+template <typename Func>
+static
+std::vector<perf_latency_result> time_parallel_open_loop(Func func, double rate, int iterations = 5) {
+    using clk = std::chrono::steady_clock;
+    std::vector<perf_latency_result> results;
+    for (int i = 0; i < iterations; ++i) {
+        auto start = clk::now();
+        auto end_at = start + std::chrono::seconds(1);
+        distributed<open_loop_executor<Func>> exec;
+        exec.start(rate / smp::count, func, end_at).get();
+        auto shard_result = exec.map_reduce0(std::mem_fn(&open_loop_executor<Func>::run),
+                open_loop_shard_result(), std::plus<open_loop_shard_result>()).get0();
+        auto end = clk::now();
+        auto duration = std::chrono::duration<double>(end - start).count();
+        auto& stats = shard_result.stats;
+
+        perf_latency_result result;
+        result.throughput = static_cast<double>(stats.invocations) / duration;
+        result.mallocs_per_op = double(stats.allocations) / stats.invocations;
+        result.tasks_per_op = double(stats.tasks_executed) / stats.invocations;
+        result.instructions_per_op = double(stats.instructions_retired) / stats.invocations;
+        result.cpu_cycles_per_op = double(stats.cpu_cycles_retired) / stats.invocations;
+        result.cache_misses_per_op = double(stats.cache_misses) / stats.invocations;
+        result.latencies = std::move(shard_result.latencies);
+
+        std::cout << result << std::endl;
+        results.emplace_back(std::move(result));
+        exec.stop().get();
+    }
+    return results;
+}
+
+/**
+ * Sweeps arrival rates to find the highest rate at which the measured p99
+ * latency stays within target_p99. run_at_rate is invoked with a total rate
+ * in operations per second and must return the p99 latency observed at that
+ * rate. The rate is doubled starting from initial_rate until the target is
+ * exceeded, and the knee of the latency curve is then narrowed down by
+ * bisection.
+ *
+ * Returns the highest rate which met the target, or 0 if even initial_rate
+ * did not.
+ */
+template <typename RunAtRate>
+static
+double find_max_rate_for_p99(RunAtRate run_at_rate, double initial_rate, std::chrono::nanoseconds target_p99) {
+    double good_rate = 0;
+    double bad_rate = 0;
+    auto rate = initial_rate;
+    while (!bad_rate) {
+        if (run_at_rate(rate) <= target_p99) {
+            good_rate = rate;
+            rate *= 2;
+        } else {
+            bad_rate = rate;
+        }
+    }
+    for (int i = 0; i < 5 && good_rate; ++i) {
+        rate = (good_rate + bad_rate) / 2;
+        if (run_at_rate(rate) <= target_p99) {
+            good_rate = rate;
+        } else {
+            bad_rate = rate;
+        }
+    }
+    return good_rate;
+}
+
 template<typename Func>
 auto duration_in_seconds(Func&& f) {
     using clk = std::chrono::steady_clock;
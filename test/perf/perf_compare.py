@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+#
+# Copyright (C) 2022-present ScyllaDB
+#
+#
+# SPDX-License-Identifier: AGPL-3.0-or-later
+#
+
+# Compares two sets of perf_simple_query --json-result files (e.g. baseline
+# vs patched) and reports whether the throughput difference is statistically
+# significant. Per-iteration throughputs ("all tps") from all files of a side
+# are pooled and compared with a two-sided Mann-Whitney U test, so no
+# distribution assumptions are made and repeated runs on each side sharpen
+# the verdict.
+
+import argparse
+import json
+import math
+
+cmdline_parser = argparse.ArgumentParser(formatter_class=argparse.ArgumentDefaultsHelpFormatter)
+cmdline_parser.add_argument('-a', '--baseline', nargs='+', required=True,
+                            help='JSON result files of the baseline (A) side')
+cmdline_parser.add_argument('-b', '--candidate', nargs='+', required=True,
+                            help='JSON result files of the candidate (B) side')
+cmdline_parser.add_argument('--alpha', type=float, default=0.05,
+                            help='significance level')
+
+
+def load_samples(files):
+    samples = []
+    for name in files:
+        stats = json.loads(open(name).read())['results']['stats']
+        if 'all tps' in stats:
+            samples.extend(stats['all tps'])
+        else:
+            # Old result files carry only the median.
+            samples.append(stats['median tps'])
+    return samples
+
+
+def median(samples):
+    s = sorted(samples)
+    n = len(s)
+    return s[n // 2] if n % 2 else (s[n // 2 - 1] + s[n // 2]) / 2
+
+
+def mann_whitney_u(a, b):
+    # Two-sided Mann-Whitney U test, normal approximation with tie
+    # correction. Returns (u, p_value).
+    pooled = sorted((x, 0) for x in a) + sorted((x, 1) for x in b)
+    pooled.sort(key=lambda v: v[0])
+    ranks = {}
+    i = 0
+    while i < len(pooled):
+        j = i
+        while j < len(pooled) and pooled[j][0] == pooled[i][0]:
+            j += 1
+        rank = (i + j + 1) / 2  # average rank of the tie group, 1-based
+        ranks.setdefault(pooled[i][0], rank)
+        i = j
+    rank_sum_a = sum(ranks[x] for x in a)
+    n_a, n_b = len(a), len(b)
+    u_a = rank_sum_a - n_a * (n_a + 1) / 2
+    u = min(u_a, n_a * n_b - u_a)
+    mean_u = n_a * n_b / 2
+    tie_groups = {}
+    for x, _ in pooled:
+        tie_groups[x] = tie_groups.get(x, 0) + 1
+    n = n_a + n_b
+    tie_correction = sum(t ** 3 - t for t in tie_groups.values()) / (n * (n - 1)) if n > 1 else 0
+    var_u = n_a * n_b / 12 * (n + 1 - tie_correction)
+    if var_u == 0:
+        return u, 1.0
+    z = (u - mean_u + 0.5) / math.sqrt(var_u)  # continuity correction
+    p = math.erfc(abs(z) / math.sqrt(2))
+    return u, p
+
+
+def main():
+    args = cmdline_parser.parse_args()
+    a = load_samples(args.baseline)
+    b = load_samples(args.candidate)
+
+    median_a = median(a)
+    median_b = median(b)
+    diff = (median_b - median_a) / median_a * 100
+
+    u, p = mann_whitney_u(a, b)
+    print(f'baseline:  {len(a)} samples, median {median_a:.2f} tps')
+    print(f'candidate: {len(b)} samples, median {median_b:.2f} tps')
+    print(f'difference: {diff:+.2f}%')
+    print(f'Mann-Whitney U = {u:.1f}, p = {p:.4f}')
+    if p < args.alpha:
+        print(f'significant at alpha = {args.alpha}')
+    else:
+        print(f'NOT significant at alpha = {args.alpha} - collect more runs or treat as noise')
+
+
+if __name__ == '__main__':
+    main()
@@ -59,7 +59,7 @@ static void execute_counter_update_for_key(cql_test_env& env, const bytes& key)
 };
 
 struct test_config {
-    enum class run_mode { read, write, del };
+    enum class run_mode { read, write, del, query, batch_write };
     enum class frontend_type { cql, alternator };
 
     run_mode mode;
@@ -71,6 +71,8 @@ struct test_config {
     bool counters;
     bool flush_memtables;
     unsigned operations_per_shard = 0;
+    double open_loop_rate = 0; // total operations per second; 0 means closed loop
+    double target_p99_ms = 0; // sweep for the max open-loop rate meeting this p99
 };
 
 std::ostream& operator<<(std::ostream& os, const test_config::run_mode& m) {
@@ -78,6 +80,8 @@ std::ostream& operator<<(std::ostream& os, const test_config::run_mode& m) {
         case test_config::run_mode::write: return os << "write";
         case test_config::run_mode::read: return os << "read";
         case test_config::run_mode::del: return os << "delete";
+        case test_config::run_mode::query: return os << "query";
+        case test_config::run_mode::batch_write: return os << "batch_write";
     }
     abort();
 }
@@ -116,6 +120,39 @@ static void create_partitions(cql_test_env& env, test_config& cfg) {
     }
 }
 
+// Runs the workload either closed-loop (fixed concurrency, the default) or,
+// when --rate was given, open-loop with Poisson arrivals. With --target-p99
+// the open-loop run is preceded by a rate sweep which finds the highest rate
+// still meeting the latency target; the final run is made at that rate.
+template <typename Func>
+static std::vector<perf_result> run_test(Func func, test_config& cfg) {
+    if (!cfg.open_loop_rate) {
+        return time_parallel(std::move(func), cfg.concurrency, cfg.duration_in_seconds, cfg.operations_per_shard);
+    }
+    auto rate = cfg.open_loop_rate;
+    if (cfg.target_p99_ms) {
+        auto target = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::duration<double, std::milli>(cfg.target_p99_ms));
+        rate = find_max_rate_for_p99([&] (double r) {
+            std::cout << "Trying " << r << " ops/s..." << std::endl;
+            auto results = time_parallel_open_loop(func, r, cfg.duration_in_seconds);
+            utils::estimated_histogram latencies{300};
+            for (auto& res : results) {
+                latencies.merge(res.latencies);
+            }
+            return std::chrono::nanoseconds(latencies.percentile(0.99));
+        }, rate, target);
+        if (!rate) {
+            std::cout << "p99 target of " << cfg.target_p99_ms << " ms not met even at " << cfg.open_loop_rate << " ops/s" << std::endl;
+            rate = cfg.open_loop_rate;
+        } else {
+            std::cout << "Max rate with p99 <= " << cfg.target_p99_ms << " ms: " << rate << " ops/s" << std::endl;
+        }
+    }
+    auto results = time_parallel_open_loop(std::move(func), rate, cfg.duration_in_seconds);
+    return std::vector<perf_result>(results.begin(), results.end());
+}
+
 static int64_t make_random_seq(test_config& cfg) {
     return cfg.query_single_key ? 0 : tests::random::get_int<uint64_t>(cfg.partitions - 1);
 }
@@ -127,10 +164,10 @@ static bytes make_random_key(test_config& cfg) {
 static std::vector<perf_result> test_read(cql_test_env& env, test_config& cfg) {
     create_partitions(env, cfg);
     auto id = env.prepare("select \"C0\", \"C1\", \"C2\", \"C3\", \"C4\" from cf where \"KEY\" = ?").get0();
-    return time_parallel([&env, &cfg, id] {
+    return run_test([&env, &cfg, id] {
             bytes key = make_random_key(cfg);
             return env.execute_prepared(id, {{cql3::raw_value::make_value(std::move(key))}}).discard_result();
-        }, cfg.concurrency, cfg.duration_in_seconds, cfg.operations_per_shard);
+        }, cfg);
 }
 
 static std::vector<perf_result> test_write(cql_test_env& env, test_config& cfg) {
@@ -141,19 +178,19 @@ static std::vector<perf_result> test_write(cql_test_env& env, test_config& cfg)
                            "\"C3\" = 0x62bcb1dbc0ff953abc703bcb63ea954f437064c0c45366799658bd6b91d0f92908d7,"
                            "\"C4\" = 0x222fcbe31ffa1e689540e1499b87fa3f9c781065fccd10e4772b4c7039c2efd0fb27 "
                            "WHERE \"KEY\" = ?;").get0();
-    return time_parallel([&env, &cfg, id] {
+    return run_test([&env, &cfg, id] {
             bytes key = make_random_key(cfg);
             return env.execute_prepared(id, {{cql3::raw_value::make_value(std::move(key))}}).discard_result();
-        }, cfg.concurrency, cfg.duration_in_seconds, cfg.operations_per_shard);
+        }, cfg);
 }
 
 static std::vector<perf_result> test_delete(cql_test_env& env, test_config& cfg) {
     create_partitions(env, cfg);
     auto id = env.prepare("DELETE \"C0\", \"C1\", \"C2\", \"C3\", \"C4\" FROM cf WHERE \"KEY\" = ?").get0();
-    return time_parallel([&env, &cfg, id] {
+    return run_test([&env, &cfg, id] {
             bytes key = make_random_key(cfg);
             return env.execute_prepared(id, {{cql3::raw_value::make_value(std::move(key))}}).discard_result();
-        }, cfg.concurrency, cfg.duration_in_seconds, cfg.operations_per_shard);
+        }, cfg);
 }
 
 static std::vector<perf_result> test_counter_update(cql_test_env& env, test_config& cfg) {
@@ -164,10 +201,10 @@ static std::vector<perf_result> test_counter_update(cql_test_env& env, test_conf
                            "\"C3\" = \"C3\" + 4,"
                            "\"C4\" = \"C4\" + 5 "
                            "WHERE \"KEY\" = ?;").get0();
-    return time_parallel([&env, &cfg, id] {
+    return run_test([&env, &cfg, id] {
             bytes key = make_random_key(cfg);
             return env.execute_prepared(id, {{cql3::raw_value::make_value(std::move(key))}}).discard_result();
-        }, cfg.concurrency, cfg.duration_in_seconds, cfg.operations_per_shard);
+        }, cfg);
 }
 
 static schema_ptr make_counter_schema(std::string_view ks_name) {
@@ -271,7 +308,7 @@ static std::vector<perf_result> test_alternator_read(service::client_state& stat
                 "ReturnConsumedCapacity": "TOTAL"
             }
         )";
-    return time_parallel([&] {
+    return run_test([&] {
         auto key = std::to_string(make_random_seq(cfg));
         // Chunked content is used to minimize string copying, and thus extra allocations
         rjson::chunked_content content;
@@ -280,11 +317,90 @@ static std::vector<perf_result> test_alternator_read(service::client_state& stat
         content.emplace_back(key.data(), key.size(), deleter{});
         content.emplace_back(postfix.data(), postfix.size(), deleter{});
         return executor.get_item(state, tracing::trace_state_ptr(), empty_service_permit(), rjson::parse(std::move(content))).discard_result();
-    }, cfg.concurrency, cfg.duration_in_seconds, cfg.operations_per_shard);
+    }, cfg);
+}
+
+static std::vector<perf_result> test_alternator_query(service::client_state& state, noncopyable_function<void()> flush_memtables,
+        alternator::executor& executor, test_config& cfg) {
+    create_alternator_partitions(state, std::move(flush_memtables), executor, cfg);
+    std::string prefix = R"(
+        {
+            "TableName": "alternator_table",
+            "KeyConditionExpression": "p = :p",
+            "ExpressionAttributeValues": {
+                ":p": {
+                    "S": ")";
+    std::string postfix = R"("
+                    }
+                },
+                "ConsistentRead": false,
+                "ReturnConsumedCapacity": "TOTAL"
+            }
+        )";
+    return run_test([&] {
+        auto key = std::to_string(make_random_seq(cfg));
+        // Chunked content is used to minimize string copying, and thus extra allocations
+        rjson::chunked_content content;
+        content.reserve(3);
+        content.emplace_back(prefix.data(), prefix.size(), deleter{});
+        content.emplace_back(key.data(), key.size(), deleter{});
+        content.emplace_back(postfix.data(), postfix.size(), deleter{});
+        return executor.query(state, tracing::trace_state_ptr(), empty_service_permit(), rjson::parse(std::move(content))).discard_result();
+    }, cfg);
+}
+
+static std::vector<perf_result> test_alternator_batch_write(service::client_state& state, alternator::executor& executor, test_config& cfg) {
+    // The DynamoDB API limits a single BatchWriteItem request to 25 items.
+    static constexpr int64_t batch_size = 25;
+    return run_test([&] {
+        // Keys within one batch must be distinct, so write a consecutive run
+        // of keys starting at a random position.
+        auto base = make_random_seq(cfg);
+        std::string json = R"(
+            {
+                "RequestItems": {
+                    "alternator_table": [)";
+        for (int64_t i = 0; i < batch_size; ++i) {
+            if (i > 0) {
+                json += ",";
+            }
+            json += R"(
+                        {
+                            "PutRequest": {
+                                "Item": {
+                                    "p": {
+                                        "S": ")" + std::to_string(base + i) + R"("
+                                    },
+                                    "C0": {
+                                        "S": "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx"
+                                    },
+                                    "C1": {
+                                        "S": "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx"
+                                    },
+                                    "C2": {
+                                        "S": "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx"
+                                    },
+                                    "C3": {
+                                        "S": "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx"
+                                    },
+                                    "C4": {
+                                        "S": "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx"
+                                    }
+                                }
+                            }
+                        })";
+        }
+        json += R"(
+                    ]
+                }
+            }
+        )";
+        return executor.batch_write_item(state, tracing::trace_state_ptr(), empty_service_permit(), rjson::parse(json)).discard_result();
+    }, cfg);
 }
 
 static std::vector<perf_result> test_alternator_write(service::client_state& state, alternator::executor& executor, test_config& cfg) {
-    return time_parallel([&] {
+    return run_test([&] {
         std::string prefix = R"(
             {
                 "TableName": "alternator_table",
@@ -323,13 +439,13 @@ static std::vector<perf_result> test_alternator_write(service::client_state& sta
         content.emplace_back(key.data(), key.size(), deleter{});
         content.emplace_back(postfix.data(), postfix.size(), deleter{});
         return executor.update_item(state, tracing::trace_state_ptr(), empty_service_permit(), rjson::parse(std::move(content))).discard_result();
-    }, cfg.concurrency, cfg.duration_in_seconds, cfg.operations_per_shard);
+    }, cfg);
 }
 
 static std::vector<perf_result> test_alternator_delete(service::client_state& state, noncopyable_function<void()> flush_memtables,
         alternator::executor& executor, test_config& cfg) {
     create_alternator_partitions(state, std::move(flush_memtables), executor, cfg);
-    return time_parallel([&] {
+    return run_test([&] {
         std::string json = R"(
             {
                 "TableName": "alternator_table",
@@ -342,7 +458,7 @@ static std::vector<perf_result> test_alternator_delete(service::client_state& st
             }
         )";
         return executor.delete_item(state, tracing::trace_state_ptr(), empty_service_permit(), rjson::parse(json)).discard_result();
-    }, cfg.concurrency, cfg.duration_in_seconds, cfg.operations_per_shard);
+    }, cfg);
 }
 
 static std::vector<perf_result> do_alternator_test(std::string isolation_level,
@@ -375,6 +491,10 @@ static std::vector<perf_result> do_alternator_test(std::string isolation_level,
             return test_alternator_write(state, executor, cfg);
         case test_config::run_mode::del:
             return test_alternator_delete(state, std::move(flush_memtables), executor, cfg);
+        case test_config::run_mode::query:
+            return test_alternator_query(state, std::move(flush_memtables), executor, cfg);
+        case test_config::run_mode::batch_write:
+            return test_alternator_batch_write(state, executor, cfg);
         };
     } catch (const alternator::api_error& e) {
         std::cout << "Alternator API error: " << e._msg << std::endl;
@@ -412,11 +532,14 @@ static std::vector<perf_result> do_cql_test(cql_test_env& env, test_config& cfg)
         }
     case test_config::run_mode::del:
         return test_delete(env, cfg);
+    case test_config::run_mode::query:
+    case test_config::run_mode::batch_write:
+        throw std::runtime_error("--query and --batch-write are only supported with --alternator");
     };
     abort();
 }
 
-void write_json_result(std::string result_file, const test_config& cfg, perf_result median, double mad, double max, double min) {
+void write_json_result(std::string result_file, const test_config& cfg, const std::vector<perf_result>& all_results, perf_result median, double mad, double max, double min) {
     Json::Value results;
 
     Json::Value params;
@@ -435,6 +558,18 @@ void write_json_result(std::string result_file, const test_config& cfg, perf_res
     stats["mad tps"] = mad;
     stats["max tps"] = max;
     stats["min tps"] = min;
+    // Per-iteration throughputs, for significance testing across runs
+    // (see perf_compare.py).
+    Json::Value all_tps(Json::arrayValue);
+    for (auto& result : all_results) {
+        all_tps.append(result.throughput);
+    }
+    stats["all tps"] = std::move(all_tps);
+    stats["allocs_per_op"] = median.mallocs_per_op;
+    stats["tasks_per_op"] = median.tasks_per_op;
+    stats["insns_per_op"] = median.instructions_per_op;
+    stats["cycles_per_op"] = median.cpu_cycles_per_op;
+    stats["cache_misses_per_op"] = median.cache_misses_per_op;
     results["stats"] = std::move(stats);
 
     std::string test_type;
@@ -442,6 +577,8 @@ void write_json_result(std::string result_file, const test_config& cfg, perf_res
     case test_config::run_mode::read: test_type = "read"; break;
     case test_config::run_mode::write: test_type = "write"; break;
     case test_config::run_mode::del: test_type = "delete"; break;
+    case test_config::run_mode::query: test_type = "query"; break;
+    case test_config::run_mode::batch_write: test_type = "batch_write"; break;
     }
     if (cfg.counters) {
         test_type += "_counters";
@@ -482,10 +619,14 @@ int main(int argc, char** argv) {
         ("partitions", bpo::value<unsigned>()->default_value(10000), "number of partitions")
         ("write", "test write path instead of read path")
         ("delete", "test delete path instead of read path")
+        ("query", "test Query path instead of read path (alternator only)")
+        ("batch-write", "test BatchWriteItem path instead of read path (alternator only)")
         ("duration", bpo::value<unsigned>()->default_value(5), "test duration in seconds")
         ("query-single-key", "test reading with a single key instead of random keys")
         ("concurrency", bpo::value<unsigned>()->default_value(100), "workers per core")
         ("operations-per-shard", bpo::value<unsigned>(), "run this many operations per shard (overrides duration)")
+        ("rate", bpo::value<double>(), "run open-loop with Poisson arrivals at this total rate (ops/s) instead of closed-loop with fixed concurrency, and report the latency distribution")
+        ("target-p99", bpo::value<double>(), "sweep open-loop arrival rates, starting from --rate, to find the max rate with p99 latency below this many milliseconds")
         ("counters", "test counters")
         ("flush", "flush memtables before test")
         ("json-result", bpo::value<std::string>(), "name of the json result file")
@@ -523,6 +664,10 @@ int main(int argc, char** argv) {
                 cfg.mode = test_config::run_mode::write;
             } else if (app.configuration().contains("delete")) {
                 cfg.mode = test_config::run_mode::del;
+            } else if (app.configuration().contains("query")) {
+                cfg.mode = test_config::run_mode::query;
+            } else if (app.configuration().contains("batch-write")) {
+                cfg.mode = test_config::run_mode::batch_write;
             } else {
                 cfg.mode = test_config::run_mode::read;
             };
@@ -534,6 +679,15 @@ int main(int argc, char** argv) {
             if (app.configuration().contains("operations-per-shard")) {
                 cfg.operations_per_shard = app.configuration()["operations-per-shard"].as<unsigned>();
             }
+            if (app.configuration().contains("rate")) {
+                cfg.open_loop_rate = app.configuration()["rate"].as<double>();
+            }
+            if (app.configuration().contains("target-p99")) {
+                if (!cfg.open_loop_rate) {
+                    throw std::runtime_error("--target-p99 requires --rate");
+                }
+                cfg.target_p99_ms = app.configuration()["target-p99"].as<double>();
+            }
             auto results = cfg.frontend == test_config::frontend_type::cql
                     ? do_cql_test(env, cfg)
                     : do_alternator_test(app.configuration()["alternator"].as<std::string>(),
@@ -554,7 +708,7 @@ int main(int argc, char** argv) {
             std::cout << format("\nmedian {}\nmedian absolute deviation: {:.2f}\nmaximum: {:.2f}\nminimum: {:.2f}\n", median_result, mad, max, min);
 
             if (app.configuration().contains("json-result")) {
-                write_json_result(app.configuration()["json-result"].as<std::string>(), cfg, median_result, mad, max, min);
+                write_json_result(app.configuration()["json-result"].as<std::string>(), cfg, results, median_result, mad, max, min);
             }
           }, std::move(cfg));
         });
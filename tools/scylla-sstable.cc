@@ -15,6 +15,7 @@
 #include <seastar/util/closeable.hh>
 
 #include "compaction/compaction.hh"
+#include "compaction/compaction_strategy.hh"
 #include "db/config.hh"
 #include "db/large_data_handler.hh"
 #include "gms/feature_service.hh"
@@ -1459,6 +1460,103 @@ void decompress_operation(schema_ptr schema, reader_permit permit, const std::ve
     }
 }
 
+void reshape_plan_operation(schema_ptr schema, reader_permit permit, const std::vector<sstables::shared_sstable>& sstables, const bpo::variables_map& vm) {
+    if (!vm.count("compaction-strategy")) {
+        throw std::invalid_argument("missing required option '--compaction-strategy'");
+    }
+    const auto strategy_type = sstables::compaction_strategy::type(sstring(vm["compaction-strategy"].as<std::string>()));
+
+    std::map<sstring, sstring> strategy_options;
+    if (vm.count("strategy-option")) {
+        for (const auto& opt : vm["strategy-option"].as<std::vector<sstring>>()) {
+            const auto pos = opt.find('=');
+            if (pos == sstring::npos) {
+                throw std::invalid_argument(format("invalid --strategy-option {}: expected key=value", opt));
+            }
+            strategy_options[opt.substr(0, pos)] = opt.substr(pos + 1);
+        }
+    }
+
+    const auto mode_name = vm["reshape-mode"].as<std::string>();
+    sstables::reshape_mode mode;
+    if (mode_name == "strict") {
+        mode = sstables::reshape_mode::strict;
+    } else if (mode_name == "relaxed") {
+        mode = sstables::reshape_mode::relaxed;
+    } else {
+        throw std::invalid_argument(format("invalid --reshape-mode {}: expected strict or relaxed", mode_name));
+    }
+
+    auto strategy = sstables::make_compaction_strategy(strategy_type, strategy_options);
+
+    uint64_t total_bytes = 0;
+    for (const auto& sst : sstables) {
+        total_bytes += sst->ondisk_data_size();
+    }
+
+    json_writer writer;
+    writer.StartObject();
+    writer.Key("strategy");
+    writer.String(sstables::compaction_strategy::name(strategy_type));
+    writer.Key("reshape_mode");
+    writer.String(mode_name);
+    writer.Key("jobs");
+    writer.StartArray();
+
+    // Drain the reshape logic the same way off-strategy compaction does,
+    // except jobs are only recorded, never run. Without running them we
+    // don't have their outputs, so this is the first reshape pass only;
+    // strategies that would iterate on the outputs (e.g. leveled promoting
+    // through several levels) will do additional, smaller passes in reality.
+    uint64_t reshaped_bytes = 0;
+    size_t jobs = 0;
+    auto input = sstables;
+    while (true) {
+        auto desc = strategy.get_reshaping_job(input, schema, default_priority_class(), mode);
+        if (desc.sstables.empty()) {
+            break;
+        }
+        uint64_t job_bytes = 0;
+        writer.StartObject();
+        writer.Key("inputs");
+        writer.StartArray();
+        for (const auto& sst : desc.sstables) {
+            writer.String(sst->get_filename());
+            job_bytes += sst->ondisk_data_size();
+        }
+        writer.EndArray();
+        writer.Key("input_sstables");
+        writer.Uint64(desc.sstables.size());
+        writer.Key("input_bytes");
+        writer.Uint64(job_bytes);
+        writer.Key("output_level");
+        writer.Int(desc.level);
+        if (desc.max_sstable_bytes != sstables::compaction_descriptor::default_max_sstable_bytes) {
+            writer.Key("max_output_sstable_bytes");
+            writer.Uint64(desc.max_sstable_bytes);
+        }
+        writer.EndObject();
+
+        reshaped_bytes += job_bytes;
+        ++jobs;
+        auto consumed = std::unordered_set<sstables::shared_sstable>(desc.sstables.begin(), desc.sstables.end());
+        input.erase(std::remove_if(input.begin(), input.end(), [&consumed] (const sstables::shared_sstable& sst) { return consumed.contains(sst); }), input.end());
+    }
+    writer.EndArray();
+
+    writer.Key("job_count");
+    writer.Uint64(jobs);
+    writer.Key("total_bytes");
+    writer.Uint64(total_bytes);
+    writer.Key("reshaped_bytes");
+    writer.Uint64(reshaped_bytes);
+    writer.Key("reshaped_fraction");
+    writer.Double(total_bytes ? double(reshaped_bytes) / double(total_bytes) : 0.0);
+    writer.Key("untouched_sstables");
+    writer.Uint64(input.size());
+    writer.EndObject();
+}
+
 template <typename SstableConsumer>
 void sstable_consumer_operation(schema_ptr schema, reader_permit permit, const std::vector<sstables::shared_sstable>& sstables, const bpo::variables_map& vm) {
     const auto merge = vm.count("merge");
@@ -1529,6 +1627,9 @@ const std::vector<option> all_options {
     typed_option<>("no-skips", "don't use skips to skip to next partition when the partition filter rejects one, this is slower but works with corrupt index"),
     typed_option<std::string>("bucket", "months", "the unit of time to use as bucket, one of (years, months, weeks, days, hours)"),
     typed_option<std::string>("output-format", "json", "the output-format, one of (text, json)"),
+    typed_option<std::string>("compaction-strategy", "the compaction strategy to simulate, by the same name used in the schema (e.g. SizeTieredCompactionStrategy)"),
+    typed_option<std::vector<sstring>>("strategy-option", "compaction strategy option in key=value form, can be specified multiple times"),
+    typed_option<std::string>("reshape-mode", "strict", "the reshape mode to simulate, one of (strict, relaxed)"),
 };
 
 const std::vector<operation> operations{
@@ -1976,6 +2077,10 @@ data type of the key components. Partitions are ordered according to their token
 (hashes), so partitions are unordered in the sense that a hash-table is
 unordered: they have a random order as perceived by they user but they have a
 well defined internal order.
+
+This operation can use multiple shards: start the tool with --smp N and the
+sstables are distributed across the N shards, each validating its share in
+parallel. Results are logged per sstable as usual.
 )",
             {"merge"},
             validate_operation},
@@ -2001,6 +2106,9 @@ The content is dumped in JSON, using the following schema:
 
 $ROOT := { "$sstable_path": Bool, ... }
 
+This operation can use multiple shards: start the tool with --smp N and the
+sstables are distributed across the N shards, each validating its share in
+parallel.
 )",
             validate_checksums_operation},
     {"decompress",
@@ -2016,6 +2124,53 @@ the output will be:
     md-12311-big-Data.db.decompressed
 )",
             decompress_operation},
+    {"reshape-plan",
+            "Dry-run a compaction strategy switch against the sstable(s)",
+R"(
+Report the reshape jobs a compaction strategy would schedule for the given
+sstables, without running any of them. This is the same decision logic
+off-strategy compaction applies after a strategy switch or a refresh
+(get_reshaping_job), driven to exhaustion: each reported job's inputs are
+removed from the candidate set and the strategy is asked again, until it has
+nothing more to do.
+
+The strategy to simulate is selected with --compaction-strategy, its options
+are passed as repeated --strategy-option key=value arguments, and
+--reshape-mode picks between the strict and relaxed reshape variants.
+
+Only the metadata components of the sstables are used, so the operation is
+cheap and can be run against a copy of a production table's sstable directory.
+
+Note that the report covers the first reshape pass only: jobs are not run, so
+their outputs cannot be fed back into the strategy. Strategies that iterate on
+outputs (e.g. leveled compaction promoting data through several levels) will
+schedule additional, smaller passes in reality, and the reported
+reshaped_bytes is accordingly a lower bound on the total write amplification
+of the switch.
+
+The report is dumped in JSON, using the following schema:
+
+$ROOT := {
+    "strategy": String,
+    "reshape_mode": String, // strict or relaxed
+    "jobs": [$JOB, ...],
+    "job_count": Uint64,
+    "total_bytes": Uint64, // on-disk data size of all input sstables
+    "reshaped_bytes": Uint64, // on-disk data size of all job inputs
+    "reshaped_fraction": Double, // reshaped_bytes / total_bytes
+    "untouched_sstables": Uint64 // sstables no job wants to touch
+}
+
+$JOB := {
+    "inputs": [String, ...], // filenames
+    "input_sstables": Uint64,
+    "input_bytes": Uint64,
+    "output_level": Int,
+    "max_output_sstable_bytes": Uint64 // absent if unbounded
+}
+)",
+            {"compaction-strategy", "strategy-option", "reshape-mode"},
+            reshape_plan_operation},
 };
 
 } // anonymous namespace
@@ -2159,23 +2314,79 @@ $ scylla sstable validate /path/to/md-123456-big-Data.db /path/to/md-123457-big-
 
             const auto& operation = *found_op;
 
-            schema_ptr schema;
-            std::string schema_source_opt;
-            try {
+            // Schemas are shard-local, so each shard participating in the
+            // operation has to load its own copy.
+            auto load_schema = [&app_config] () -> schema_ptr {
                 if (auto it = app_config.find("system-schema"); it != app_config.end()) {
-                    schema_source_opt = "system-schema";
                     std::vector<sstring> comps;
                     boost::split(comps, app_config["system-schema"].as<sstring>(), boost::is_any_of("."));
-                    schema = tools::load_system_schema(comps.at(0), comps.at(1));
-                } else {
-                    schema_source_opt = "schema-file";
-                    schema = tools::load_one_schema_from_file(std::filesystem::path(app_config["schema-file"].as<sstring>())).get();
+                    return tools::load_system_schema(comps.at(0), comps.at(1));
                 }
+                return tools::load_one_schema_from_file(std::filesystem::path(app_config["schema-file"].as<sstring>())).get();
+            };
+
+            schema_ptr schema;
+            try {
+                schema = load_schema();
             } catch (...) {
+                const std::string schema_source_opt = app_config.contains("system-schema") ? "system-schema" : "schema-file";
                 fmt::print(std::cerr, "error: could not load {} '{}': {}\n", schema_source_opt, app_config[schema_source_opt].as<sstring>(), std::current_exception());
                 return 1;
             }
 
+            if (!app_config.count("sstables")) {
+                std::cerr << "error: no sstables specified on the command line\n";
+                return 2;
+            }
+            const auto sstable_paths = app_config["sstables"].as<std::vector<sstring>>();
+
+            // The validate operations only write log lines, so their work can
+            // be spread over all shards the tool was started with (--smp),
+            // each shard validating its share of the sstables in an
+            // environment of its own. The other operations dump an ordered
+            // stream to stdout and remain single-shard.
+            if (smp::count > 1) {
+                if (operation.name() != "validate" && operation.name() != "validate-checksums") {
+                    fmt::print(std::cerr, "error: operation {} does not support --smp > 1\n", operation.name());
+                    return 2;
+                }
+                if (app_config.count("merge")) {
+                    fmt::print(std::cerr, "error: --merge cannot be combined with --smp > 1\n");
+                    return 2;
+                }
+                sst_log.info("validating {} sstables on {} shards", sstable_paths.size(), smp::count);
+                smp::invoke_on_all([&operation, &app_config, &sstable_paths, &load_schema] {
+                    return async([&operation, &app_config, &sstable_paths, &load_schema] {
+                        std::vector<sstring> shard_paths;
+                        for (size_t i = this_shard_id(); i < sstable_paths.size(); i += smp::count) {
+                            shard_paths.push_back(sstable_paths[i]);
+                        }
+                        if (shard_paths.empty()) {
+                            return;
+                        }
+
+                        auto shard_schema = load_schema();
+
+                        db::nop_large_data_handler shard_large_data_handler;
+                        db::config shard_dbcfg;
+                        gms::feature_service shard_feature_service(gms::feature_config_from_db_config(shard_dbcfg));
+                        cache_tracker shard_tracker;
+                        shard_dbcfg.host_id = ::utils::make_random_uuid();
+                        sstables::sstables_manager shard_sst_man(shard_large_data_handler, shard_dbcfg, shard_feature_service, shard_tracker);
+                        auto close_sst_man = deferred_close(shard_sst_man);
+
+                        const auto shard_sstables = load_sstables(shard_schema, shard_sst_man, shard_paths);
+
+                        reader_concurrency_semaphore shard_sem(reader_concurrency_semaphore::no_limits{}, app_name);
+                        auto stop_semaphore = deferred_stop(shard_sem);
+                        const auto shard_permit = shard_sem.make_tracking_only_permit(shard_schema.get(), app_name, db::no_timeout);
+
+                        operation(shard_schema, shard_permit, shard_sstables, app_config);
+                    });
+                }).get();
+                return 0;
+            }
+
             db::config dbcfg;
             gms::feature_service feature_service(gms::feature_config_from_db_config(dbcfg));
             cache_tracker tracker;
@@ -2183,11 +2394,7 @@ $ scylla sstable validate /path/to/md-123456-big-Data.db /path/to/md-123457-big-
             sstables::sstables_manager sst_man(large_data_handler, dbcfg, feature_service, tracker);
             auto close_sst_man = deferred_close(sst_man);
 
-            if (!app_config.count("sstables")) {
-                std::cerr << "error: no sstables specified on the command line\n";
-                return 2;
-            }
-            const auto sstables = load_sstables(schema, sst_man, app_config["sstables"].as<std::vector<sstring>>());
+            const auto sstables = load_sstables(schema, sst_man, sstable_paths);
 
             reader_concurrency_semaphore rcs_sem(reader_concurrency_semaphore::no_limits{}, app_name);
             auto stop_semaphore = deferred_stop(rcs_sem);
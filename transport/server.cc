@@ -889,7 +889,7 @@ process_query_internal(service::client_state& client_state, distributed<cql3::qu
     auto query = in.read_long_string_view();
     auto q_state = std::make_unique<cql_query_state>(client_state, trace_state, std::move(permit));
     auto& query_state = q_state->query_state;
-    q_state->options = in.read_options(version, serialization_format, qp.local().get_cql_config());
+    q_state->options.emplace(in.read_options(version, serialization_format, qp.local().get_cql_config()));
     auto& options = *q_state->options;
     if (!cached_pk_fn_calls.empty()) {
         options.set_cached_pk_function_calls(std::move(cached_pk_fn_calls));
@@ -980,10 +980,10 @@ process_execute_internal(service::client_state& client_state, distributed<cql3::
         std::vector<cql3::raw_value_view> values;
         in.read_value_view_list(version, values);
         auto consistency = in.read_consistency();
-        q_state->options = std::make_unique<cql3::query_options>(qp.local().get_cql_config(), consistency, std::nullopt, values, false,
-                                                                 cql3::query_options::specific_options::DEFAULT, serialization_format);
+        q_state->options.emplace(qp.local().get_cql_config(), consistency, std::nullopt, std::move(values), false,
+                                 cql3::query_options::specific_options::DEFAULT, serialization_format);
     } else {
-        q_state->options = in.read_options(version, serialization_format, qp.local().get_cql_config());
+        q_state->options.emplace(in.read_options(version, serialization_format, qp.local().get_cql_config()));
     }
     auto& options = *q_state->options;
     if (!cached_pk_fn_calls.empty()) {
@@ -1129,8 +1129,8 @@ process_batch_internal(service::client_state& client_state, distributed<cql3::qu
     auto q_state = std::make_unique<cql_query_state>(client_state, trace_state, std::move(permit));
     auto& query_state = q_state->query_state;
     // #563. CQL v2 encodes query_options in v1 format for batch requests.
-    q_state->options = std::make_unique<cql3::query_options>(cql3::query_options::make_batch_options(std::move(*in.read_options(version < 3 ? 1 : version, serialization_format,
-                                                                     qp.local().get_cql_config())), std::move(values)));
+    q_state->options.emplace(cql3::query_options::make_batch_options(in.read_options(version < 3 ? 1 : version, serialization_format,
+                                                                     qp.local().get_cql_config()), std::move(values)));
     auto& options = *q_state->options;
     if (!cached_pk_fn_calls.empty()) {
         options.set_cached_pk_function_calls(std::move(cached_pk_fn_calls));
@@ -1459,11 +1459,19 @@ cql_server::connection::make_schema_change_event(const event::schema_change& eve
 
 void cql_server::connection::write_response(foreign_ptr<std::unique_ptr<cql_server::response>>&& response, service_permit permit, cql_compression compression)
 {
+    ++_unflushed_responses;
     _ready_to_respond = _ready_to_respond.then([this, compression, response = std::move(response), permit = std::move(permit)] () mutable {
         auto message = response->make_message(_version, compression);
         message.on_delete([response = std::move(response)] { });
-        return _write_buf.write(std::move(message)).then([this] {
-            return _write_buf.flush();
+        return _write_buf.write(std::move(message)).finally([this] {
+            // Responses are written back-to-back on this chain, so when more
+            // of them are already queued behind this one there is no point in
+            // flushing now - the last response of the burst issues a single
+            // flush (and thus a single syscall) for all of them.
+            if (--_unflushed_responses == 0) {
+                return _write_buf.flush();
+            }
+            return make_ready_future<>();
         });
     });
 }
@@ -1724,7 +1732,21 @@ void cql_server::response::write_value(std::optional<query::result_bytes_view> v
         return;
     }
 
-    write_int(value->size_bytes());
+    auto size = value->size_bytes();
+    // Write the length prefix and the cell payload with a single allocation
+    // instead of one per fragment. Cells larger than a bytes_ostream chunk
+    // (rare) take the generic fragment-by-fragment path below.
+    if (sizeof(int32_t) + size <= bytes_ostream::max_chunk_size()) {
+        auto* out = _body.write_place_holder(sizeof(int32_t) + size);
+        auto len = htonl(cast_if_fits<int32_t>(size));
+        out = std::copy_n(reinterpret_cast<const int8_t*>(&len), sizeof(len), out);
+        for (bytes_view fragment : *value) {
+            out = std::copy_n(fragment.data(), fragment.size(), out);
+        }
+        return;
+    }
+
+    write_int(cast_if_fits<int32_t>(size));
     using boost::range::for_each;
     for_each(*value, [&] (bytes_view fragment) {
         _body.write(fragment);
@@ -1871,23 +1893,35 @@ void cql_server::response::write(const cql3::metadata& m, bool no_metadata) {
         return;
     }
 
-    auto names_i = m.get_names().begin();
+    if (!m.cached_wire_specs()) {
+        // Encode the column specs into a scratch buffer so that the result
+        // can be cached in the (shared) metadata and spliced into every
+        // subsequent response of the statement.
+        bytes_ostream specs;
+        std::swap(_body, specs);
 
-    if (global_tables_spec) {
-        auto first_spec = *names_i;
-        write_string(first_spec->ks_name);
-        write_string(first_spec->cf_name);
-    }
+        auto names_i = m.get_names().begin();
 
-    for (uint32_t i = 0; i < m.column_count(); ++i, ++names_i) {
-        lw_shared_ptr<cql3::column_specification> name = *names_i;
-        if (!global_tables_spec) {
-            write_string(name->ks_name);
-            write_string(name->cf_name);
+        if (global_tables_spec) {
+            auto first_spec = *names_i;
+            write_string(first_spec->ks_name);
+            write_string(first_spec->cf_name);
         }
-        write_string(name->name->text());
-        type_codec::encode(*this, name->type);
+
+        for (uint32_t i = 0; i < m.column_count(); ++i, ++names_i) {
+            lw_shared_ptr<cql3::column_specification> name = *names_i;
+            if (!global_tables_spec) {
+                write_string(name->ks_name);
+                write_string(name->cf_name);
+            }
+            write_string(name->name->text());
+            type_codec::encode(*this, name->type);
+        }
+
+        std::swap(_body, specs);
+        m.set_cached_wire_specs(bytes(specs.linearize()));
     }
+    _body.write(*m.cached_wire_specs());
 }
 
 void cql_server::response::write(const cql3::prepared_metadata& m, uint8_t version)
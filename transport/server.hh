@@ -104,7 +104,9 @@ struct [[gnu::packed]] cql_binary_frame_v3 {
 
 struct cql_query_state {
     service::query_state query_state;
-    std::unique_ptr<cql3::query_options> options;
+    // Engaged once the options are read off the wire. Stored in-line so that
+    // a request needs a single allocation for its execution state.
+    std::optional<cql3::query_options> options;
 
     cql_query_state(service::client_state& client_state, tracing::trace_state_ptr trace_state_ptr, service_permit permit)
         : query_state(client_state, std::move(trace_state_ptr), std::move(permit))
@@ -192,6 +194,9 @@ private:
         service::client_state _client_state;
         timer<lowres_clock> _shedding_timer;
         bool _shed_incoming_requests = false;
+        // Number of responses queued on _ready_to_respond whose write hasn't
+        // completed yet; the one that drops it to zero flushes for the burst.
+        uint64_t _unflushed_responses = 0;
         unsigned _request_cpu = 0;
         bool _ready = false;
         bool _authenticating = false;
@@ -866,6 +866,27 @@ struct is_byte_order_equal_visitor {
 
 bool abstract_type::is_byte_order_equal() const { return visit(*this, is_byte_order_equal_visitor{}); }
 
+namespace {
+// Mirrors compare_visitor: a type qualifies only if its branch there is a
+// plain compare_unsigned(), or reads a value whose big-endian representation
+// sorts in unsigned byte order. Signed integer types do not qualify (negative
+// values sort above positive ones byte-wise), and neither do uuid/timeuuid
+// (version-first ordering) nor floats (sign/NaN handling).
+struct is_byte_order_comparable_visitor {
+    bool operator()(const abstract_type&) { return false; }
+    bool operator()(const string_type_impl&) { return true; }
+    bool operator()(const bytes_type_impl&) { return true; }
+    bool operator()(const duration_type_impl&) { return true; }
+    bool operator()(const inet_addr_type_impl&) { return true; }
+    bool operator()(const date_type_impl&) { return true; }
+    bool operator()(const boolean_type_impl&) { return true; }
+    bool operator()(const simple_date_type_impl&) { return true; }
+    bool operator()(const reversed_type_impl& t) { return t.underlying_type()->is_byte_order_comparable(); }
+};
+}
+
+bool abstract_type::is_byte_order_comparable() const { return visit(*this, is_byte_order_comparable_visitor{}); }
+
 static bool
 check_compatibility(const tuple_type_impl &t, const abstract_type& previous, bool (abstract_type::*predicate)(const abstract_type&) const);
 
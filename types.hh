@@ -559,6 +559,13 @@ public:
      * When returns false, nothing can be inferred.
      */
     bool is_byte_order_equal() const;
+    /**
+     * When returns true, comparing the byte representations with unsigned
+     * byte order gives the same result as compare().
+     *
+     * When returns false, nothing can be inferred.
+     */
+    bool is_byte_order_comparable() const;
     sstring get_string(const bytes& b) const;
     sstring to_string(bytes_view bv) const {
         return to_string_impl(deserialize(bv));
@@ -52,6 +52,31 @@ arch_target("default") unsigned array_search_x32_eq_impl(uint8_t val, const uint
     return array_search_eq_impl(val, arr, 32 * nr);
 }
 
+static inline unsigned array_search_gt_min_impl(uint8_t val, const uint8_t* arr, unsigned len) {
+    unsigned best = len;
+
+    for (unsigned i = 0; i < len; i++) {
+        // Signed comparison, see the comment in array-search.hh
+        if (static_cast<int8_t>(arr[i]) > static_cast<int8_t>(val) && (best == len || arr[i] < arr[best])) {
+            best = i;
+        }
+    }
+
+    return best;
+}
+
+arch_target("default") unsigned array_search_16_gt_min_impl(uint8_t val, const uint8_t* arr) {
+    return array_search_gt_min_impl(val, arr, 16);
+}
+
+arch_target("default") unsigned array_search_32_gt_min_impl(uint8_t val, const uint8_t* arr) {
+    return array_search_gt_min_impl(val, arr, 32);
+}
+
+arch_target("default") unsigned array_search_x32_gt_min_impl(uint8_t val, const uint8_t* arr, int nr) {
+    return array_search_gt_min_impl(val, arr, 32 * nr);
+}
+
 #ifdef __x86_64__
 
 /*
@@ -136,6 +161,74 @@ arch_target("avx2") unsigned array_search_x32_eq_impl(uint8_t val, const uint8_t
     return len;
 }
 
+/*
+ * SSE4 version of searching for the smallest element greater than the value.
+ *
+ * The signed compare makes the 0x80 unused-slot marker (-128) lose to any
+ * valid value, so unused slots need no separate masking. The minimum of the
+ * matching elements is then found with the u8-through-minpos_epu16 trick:
+ * a pairwise min folds each 16-bit lane to its smaller byte (the shift
+ * brings in zeroes to the upper bytes, which is fine since minpos only
+ * reports the smallest word and all upper bytes become zero).
+ */
+arch_target("sse4.2") unsigned array_search_16_gt_min_impl(uint8_t val, const uint8_t* arr) {
+    auto a = _mm_set1_epi8(val);
+    auto b = _mm_lddqu_si128((__m128i*)arr);
+    auto gt = _mm_cmpgt_epi8(b, a);
+    if (_mm_testz_si128(gt, gt)) {
+        return 16;
+    }
+    // Replace non-matching elements with 0xff, which cannot win -- valid
+    // elements are at most 0x7f
+    auto cand = _mm_blendv_epi8(_mm_set1_epi8(int8_t(0xff)), b, gt);
+    auto folded = _mm_min_epu8(cand, _mm_srli_epi16(cand, 8));
+    uint8_t min_val = _mm_extract_epi16(_mm_minpos_epu16(folded), 0) & 0xff;
+    unsigned m = _mm_movemask_epi8(_mm_cmpeq_epi8(cand, _mm_set1_epi8(min_val)));
+    return __builtin_ctz(m);
+}
+
+/*
+ * AVX2 version of the above, folding the two 128-bit lanes together first.
+ */
+arch_target("avx2") unsigned array_search_32_gt_min_impl(uint8_t val, const uint8_t* arr) {
+    auto a = _mm256_set1_epi8(val);
+    auto b = _mm256_lddqu_si256((__m256i*)arr);
+    auto gt = _mm256_cmpgt_epi8(b, a);
+    if (_mm256_testz_si256(gt, gt)) {
+        return 32;
+    }
+    auto cand = _mm256_blendv_epi8(_mm256_set1_epi8(int8_t(0xff)), b, gt);
+    auto half = _mm_min_epu8(_mm256_castsi256_si128(cand), _mm256_extracti128_si256(cand, 1));
+    auto folded = _mm_min_epu8(half, _mm_srli_epi16(half, 8));
+    uint8_t min_val = _mm_extract_epi16(_mm_minpos_epu16(folded), 0) & 0xff;
+    unsigned m = _mm256_movemask_epi8(_mm256_cmpeq_epi8(cand, _mm256_set1_epi8(min_val)));
+    return __builtin_ctz(m);
+}
+
+arch_target("avx2") unsigned array_search_x32_gt_min_impl(uint8_t val, const uint8_t* arr, int nr) {
+    unsigned len = 32 * nr;
+    unsigned best = len;
+    uint8_t best_val = 0xff;
+    auto a = _mm256_set1_epi8(val);
+    for (unsigned off = 0; off < len; off += 32) {
+        auto b = _mm256_lddqu_si256((__m256i*)(arr + off));
+        auto gt = _mm256_cmpgt_epi8(b, a);
+        if (_mm256_testz_si256(gt, gt)) {
+            continue;
+        }
+        auto cand = _mm256_blendv_epi8(_mm256_set1_epi8(int8_t(0xff)), b, gt);
+        auto half = _mm_min_epu8(_mm256_castsi256_si128(cand), _mm256_extracti128_si256(cand, 1));
+        auto folded = _mm_min_epu8(half, _mm_srli_epi16(half, 8));
+        uint8_t min_val = _mm_extract_epi16(_mm_minpos_epu16(folded), 0) & 0xff;
+        if (best == len || min_val < best_val) {
+            unsigned m = _mm256_movemask_epi8(_mm256_cmpeq_epi8(cand, _mm256_set1_epi8(min_val)));
+            best = off + __builtin_ctz(m);
+            best_val = min_val;
+        }
+    }
+    return best;
+}
+
 #endif
 
 int array_search_gt(int64_t val, const int64_t* array, const int capacity, const int size) {
@@ -154,4 +247,16 @@ unsigned array_search_x32_eq(uint8_t val, const uint8_t* array, int nr) {
     return array_search_x32_eq_impl(val, array, nr);
 }
 
+unsigned array_search_16_gt_min(uint8_t val, const uint8_t* array) {
+    return array_search_16_gt_min_impl(val, array);
+}
+
+unsigned array_search_32_gt_min(uint8_t val, const uint8_t* array) {
+    return array_search_32_gt_min_impl(val, array);
+}
+
+unsigned array_search_x32_gt_min(uint8_t val, const uint8_t* array, int nr) {
+    return array_search_x32_gt_min_impl(val, array, nr);
+}
+
 }
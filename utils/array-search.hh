@@ -57,4 +57,39 @@ unsigned array_search_16_eq(uint8_t val, const uint8_t* array);
 unsigned array_search_32_eq(uint8_t val, const uint8_t* array);
 unsigned array_search_x32_eq(uint8_t val, const uint8_t* array, int nr);
 
+/*
+ * array_search_N_gt_min(value, array)
+ *
+ * Returns the index of the smallest element that is strictly greater than
+ * the given value, or N when there is none.
+ *
+ * To accomodate the single-instruction-multiple-data variant, the
+ * comparison is signed 8-bit: the value must be in [0, 0x7f] and used
+ * elements must be in [0, 0x7f] too. Unused slots must be set to 0x80,
+ * which compares below everything and is thus never reported.
+ */
+static inline unsigned array_search_4_gt_min(uint8_t val, const uint8_t* array) {
+    unsigned best = 4;
+    for (unsigned i = 0; i < 4; i++) {
+        if (static_cast<int8_t>(array[i]) > static_cast<int8_t>(val) && (best == 4 || array[i] < array[best])) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+static inline unsigned array_search_8_gt_min(uint8_t val, const uint8_t* array) {
+    unsigned best = 8;
+    for (unsigned i = 0; i < 8; i++) {
+        if (static_cast<int8_t>(array[i]) > static_cast<int8_t>(val) && (best == 8 || array[i] < array[best])) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+unsigned array_search_16_gt_min(uint8_t val, const uint8_t* array);
+unsigned array_search_32_gt_min(uint8_t val, const uint8_t* array);
+unsigned array_search_x32_gt_min(uint8_t val, const uint8_t* array, int nr);
+
 }
@@ -43,10 +43,14 @@ public:
 
     virtual void add(const bytes_view& key) override;
 
+    virtual void add(hashed_key key) override;
+
     virtual bool is_present(const bytes_view& key) override;
 
     virtual bool is_present(hashed_key key) override;
 
+    virtual void prefetch(hashed_key key) override;
+
     virtual void clear() override {
         _bitset.clear();
     }
@@ -81,6 +85,8 @@ struct always_present_filter: public i_filter {
 
     virtual void add(const bytes_view& key) override { }
 
+    virtual void add(hashed_key) override { }
+
     virtual void clear() override { }
 
     virtual void close() override { }
@@ -62,13 +62,21 @@ private:
         logalloc::lsa_buffer _lsa_buf;
         temporary_buffer<char> _buf; // Empty when not shared. May mirror _lsa_buf when shared.
         size_t _use_count = 0;
+        // Set when the page was shared again after having been released to
+        // the LRU, i.e. its reuse is proven. Such pages are released to the
+        // protected LRU segment, see utils/lru.hh.
+        bool _promote = false;
     public:
         struct cached_page_del {
             void operator()(cached_page* cp) {
                 if (--cp->_use_count == 0) {
                     cp->parent->_metrics.bytes_in_std -= cp->_buf.size();
                     cp->_buf = {};
-                    cp->parent->_lru.add(*cp);
+                    if (cp->_promote) {
+                        cp->parent->_lru.touch(*cp);
+                    } else {
+                        cp->parent->_lru.add(*cp);
+                    }
                 }
             }
         };
@@ -79,6 +87,7 @@ private:
         // because it will not be linked in the LRU.
         ptr_type share() noexcept {
             if (_use_count++ == 0) {
+                _promote |= is_linked();
                 unlink_from_lru();
             }
             return std::unique_ptr<cached_page, cached_page_del>(this);
@@ -371,6 +380,20 @@ public:
         assert(_cache.empty());
     }
 
+    /// \brief Starts populating the page containing the given offset.
+    ///
+    /// Issuing the read early allows hiding its latency behind other work,
+    /// e.g. speculatively fetching the next probe positions of a binary
+    /// search. The returned future resolves when the page is cached; the
+    /// caller must keep this instance alive until then (e.g. by holding the
+    /// future and waiting for it on close).
+    future<> prefetch(offset_type offset, const io_priority_class& pc, tracing::trace_state_ptr trace_state = {}) {
+        if (offset >= _size) {
+            return make_ready_future<>();
+        }
+        return get_page_ptr(offset / page_size, 1, pc, std::move(trace_state)).discard_result();
+    }
+
     /// \brief Invalidates [start, end) or less.
     ///
     /// Invariants:
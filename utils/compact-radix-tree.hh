@@ -50,6 +50,37 @@ inline unsigned find_in_array<64>(uint8_t val, const uint8_t* arr) {
     return utils::array_search_x32_eq(val, arr, 2);
 }
 
+// Finds the smallest array element greater than val, for lower_bound
+// scans over indirect node index arrays. Relies on unused_node_index
+// being 0x80, which the search never reports (see array-search.hh).
+template <unsigned Size>
+inline unsigned find_gt_min_in_array(uint8_t val, const uint8_t* arr);
+
+template <>
+inline unsigned find_gt_min_in_array<4>(uint8_t val, const uint8_t* arr) {
+    return utils::array_search_4_gt_min(val, arr);
+}
+
+template <>
+inline unsigned find_gt_min_in_array<8>(uint8_t val, const uint8_t* arr) {
+    return utils::array_search_8_gt_min(val, arr);
+}
+
+template <>
+inline unsigned find_gt_min_in_array<16>(uint8_t val, const uint8_t* arr) {
+    return utils::array_search_16_gt_min(val, arr);
+}
+
+template <>
+inline unsigned find_gt_min_in_array<32>(uint8_t val, const uint8_t* arr) {
+    return utils::array_search_32_gt_min(val, arr);
+}
+
+template <>
+inline unsigned find_gt_min_in_array<64>(uint8_t val, const uint8_t* arr) {
+    return utils::array_search_x32_gt_min(val, arr, 2);
+}
+
 // A union of any number of types.
 
 template <typename... Ts>
@@ -1315,14 +1346,9 @@ private:
                 }
             }
 
-            unsigned ui = Size;
-            for (unsigned i = 0; i < Size; i++) {
-                if (has(i) && _idx[i] > ni && (ui == Size || _idx[i] < _idx[ui])) {
-                    ui = i;
-                }
-            }
+            unsigned ui = find_gt_min_in_array<Size>(ni, _idx);
 
-            if (ui == Size) {
+            if (ui >= Size) {
                 return lower_bound_res();
             }
 
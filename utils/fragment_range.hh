@@ -275,6 +275,15 @@ void skip_empty_fragments(View& v) {
 
 template<FragmentedView V1, FragmentedView V2>
 std::strong_ordering compare_unsigned(V1 v1, V2 v2) {
+    // Fast path: both views are single-fragment (the common case), so a
+    // single memcmp decides and we skip the fragment-advancing loop below.
+    if (v1.current_fragment().size() == v1.size_bytes() && v2.current_fragment().size() == v2.size_bytes()) [[likely]] {
+        size_t n = std::min(v1.size_bytes(), v2.size_bytes());
+        if (int d = memcmp(v1.current_fragment().data(), v2.current_fragment().data(), n)) {
+            return d <=> 0;
+        }
+        return v1.size_bytes() <=> v2.size_bytes();
+    }
     while (!v1.empty() && !v2.empty()) {
         size_t n = std::min(v1.current_fragment().size(), v2.current_fragment().size());
         if (int d = memcmp(v1.current_fragment().data(), v2.current_fragment().data(), n)) {
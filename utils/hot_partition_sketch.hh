@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2022-present ScyllaDB
+ */
+
+/*
+ * SPDX-License-Identifier: AGPL-3.0-or-later
+ */
+
+#pragma once
+
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <seastar/core/lowres_clock.hh>
+
+namespace utils {
+
+// Count-min sketch with periodic exponential decay, used to spot hot
+// partitions on the write path without keeping per-key state.
+//
+// record() charges one event to the given key hash and returns the estimated
+// number of events charged to that key in the current decay period. The
+// estimate never undercounts; hash collisions can make it overcount, with the
+// collision probability bounded by the sketch width. All counters are halved
+// once per decay period, so a sustained rate converges to about twice the
+// per-period rate while one-off bursts fade away within a few periods.
+//
+// The memory footprint is fixed at depth * width 32-bit counters and the
+// per-record cost is a handful of arithmetic operations and counter
+// increments, which makes it cheap enough for the mutation apply path.
+class hot_partition_sketch {
+public:
+    static constexpr unsigned depth = 4;
+
+private:
+    unsigned _width;
+    std::chrono::milliseconds _decay_period;
+    seastar::lowres_clock::time_point _last_decay;
+    std::vector<uint32_t> _counters;
+    uint32_t _current_max = 0;
+
+    // Odd multipliers making the rows hash independently (Knuth-style
+    // multiplicative hashing with different constants per row).
+    static constexpr uint64_t row_mixers[depth] = {
+        0x9e3779b97f4a7c15ull,
+        0xc2b2ae3d27d4eb4full,
+        0x165667b19e3779f9ull,
+        0x27d4eb2f165667c5ull,
+    };
+
+public:
+    explicit hot_partition_sketch(unsigned width = 1024, std::chrono::milliseconds decay_period = std::chrono::milliseconds(1000))
+        : _width(width)
+        , _decay_period(decay_period)
+        , _last_decay(seastar::lowres_clock::now())
+        , _counters(depth * width)
+    {
+        // The row index is computed with a mask, so the width must be a
+        // power of two.
+        assert((width & (width - 1)) == 0);
+    }
+
+    // Records `weight` events for the key identified by the given hash (for
+    // partitions, the raw token) and returns the decayed estimate of the
+    // events recorded for it in the current decay period. Passing a byte
+    // count as the weight turns the sketch into a write volume tracker.
+    uint32_t record(uint64_t key_hash, uint32_t weight = 1) noexcept {
+        maybe_decay();
+        auto estimate = std::numeric_limits<uint32_t>::max();
+        for (unsigned row = 0; row < depth; ++row) {
+            const auto h = key_hash * row_mixers[row];
+            auto& counter = _counters[row * _width + ((h >> 32) & (_width - 1))];
+            if (counter < std::numeric_limits<uint32_t>::max() - weight) {
+                counter += weight;
+            } else {
+                counter = std::numeric_limits<uint32_t>::max();
+            }
+            estimate = std::min(estimate, counter);
+        }
+        _current_max = std::max(_current_max, estimate);
+        return estimate;
+    }
+
+    // Estimated event count of the hottest key seen in the current decay
+    // period. Decays together with the counters.
+    uint32_t current_max() const noexcept {
+        return _current_max;
+    }
+
+private:
+    void maybe_decay() noexcept {
+        const auto now = seastar::lowres_clock::now();
+        if (now - _last_decay < _decay_period) {
+            return;
+        }
+        // Halve once per elapsed period so that an idle sketch decays the
+        // same way as a busy one.
+        const auto periods = std::min<int64_t>((now - _last_decay) / _decay_period, 32);
+        for (auto& counter : _counters) {
+            counter >>= periods;
+        }
+        _current_max >>= periods;
+        _last_decay = now;
+    }
+};
+
+} // namespace utils
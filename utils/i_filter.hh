@@ -38,8 +38,13 @@ struct i_filter {
     virtual ~i_filter() {}
 
     virtual void add(const bytes_view& key) = 0;
+    virtual void add(hashed_key) = 0;
     virtual bool is_present(const bytes_view& key) = 0;
     virtual bool is_present(hashed_key) = 0;
+    // Starts bringing the filter blocks probed by is_present(hashed_key) into
+    // cache. Allows batching the memory stalls of probing many filters with
+    // the same key instead of taking them serially, one filter at a time.
+    virtual void prefetch(hashed_key) {}
     virtual void clear() = 0;
     virtual void close() = 0;
 
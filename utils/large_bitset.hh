@@ -38,6 +38,11 @@ public:
         return _storage.memory_size();
     }
 
+    // Starts bringing the word holding the given bit into cache, so that a
+    // subsequent test() of the same bit doesn't stall on a cache miss.
+    void prefetch(size_t idx) const {
+        __builtin_prefetch(&_storage[idx / bits_per_int()], 0, 0);
+    }
     bool test(size_t idx) const {
         auto idx1 = idx / bits_per_int();
         idx %= bits_per_int();
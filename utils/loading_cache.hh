@@ -9,6 +9,7 @@
 #pragma once
 
 #include <chrono>
+#include <random>
 #include <unordered_map>
 #include <memory_resource>
 
@@ -598,9 +599,17 @@ private:
         // Future is waited on indirectly in `stop()` (via `_timer_reads_gate`).
         // FIXME: error handling
         (void)with_gate(_timer_reads_gate, [this] {
+            // Entries which were loaded in the same burst become due for a reload in
+            // the same timer tick, turning every refresh period into a synchronized
+            // burst of load() calls against the underlying store. Jitter each entry's
+            // deadline by up to a tenth of the refresh period so that such entries
+            // spread over multiple ticks instead.
+            static thread_local std::default_random_engine re{std::random_device{}()};
+            std::uniform_int_distribution<loading_cache_clock_type::duration::rep> jitter_dist(0, _refresh.count() / 10);
+            const auto now = loading_cache_clock_type::now();
             auto to_reload = boost::copy_range<utils::chunked_vector<timestamped_val_ptr>>(boost::range::join(_unprivileged_lru_list, _lru_list)
-                    | boost::adaptors::filtered([this] (ts_value_lru_entry& lru_entry) {
-                        return lru_entry.timestamped_value().loaded() + _refresh < loading_cache_clock_type::now();
+                    | boost::adaptors::filtered([&] (ts_value_lru_entry& lru_entry) {
+                        return lru_entry.timestamped_value().loaded() + _refresh < now + loading_cache_clock_type::duration(jitter_dist(re));
                     })
                     | boost::adaptors::transformed([] (ts_value_lru_entry& lru_entry) {
                         return lru_entry.timestamped_value_ptr();
@@ -438,6 +438,7 @@ class tracker::impl {
     seastar::metrics::metric_groups _metrics;
     bool _reclaiming_enabled = true;
     size_t _reclamation_step = 1;
+    float _idle_compaction_max_occupancy = 1.0f;
     bool _abort_on_bad_alloc = false;
 private:
     // Prevents tracker's reclaimer from running while live. Reclaimer may be
@@ -486,6 +487,8 @@ public:
     // Set the minimum number of segments reclaimed during single reclamation cycle.
     void set_reclamation_step(size_t step_in_segments) { _reclamation_step = step_in_segments; }
     size_t reclamation_step() const { return _reclamation_step; }
+    // Set the maximum occupancy of segments considered by compact_on_idle().
+    void set_idle_compaction_max_occupancy(float max_occupancy) { _idle_compaction_max_occupancy = max_occupancy; }
     // Abort on allocation failure from LSA
     void enable_abort_on_bad_alloc() { _abort_on_bad_alloc = true; }
     bool should_abort_on_bad_alloc() const { return _abort_on_bad_alloc; }
@@ -1627,8 +1630,13 @@ public:
             && _segment_descs.contains_above_min();
     }
 
-    bool is_idle_compactible() {
-        return is_compactible();
+    // Like is_compactible(), but for compaction running on idle CPU.
+    // Compacting nearly-full segments copies a lot of data for little
+    // reclaimed space, so idle compaction additionally requires the sparsest
+    // segment to be at most max_occupancy full. This bounds the amount of
+    // copying done per byte of defragmented space.
+    bool is_idle_compactible(float max_occupancy) {
+        return is_compactible() && min_occupancy().used_fraction() <= max_occupancy;
     }
 
     virtual void* alloc(allocation_strategy::migrate_fn migrator, size_t size, size_t alignment) override {
@@ -1921,6 +1929,7 @@ void tracker::configure(const config& cfg) {
         });
     }
 
+    _impl->set_idle_compaction_max_occupancy(cfg.defragment_max_segment_occupancy);
     _impl->set_reclamation_step(cfg.lsa_reclamation_step);
     if (cfg.abort_on_lsa_bad_alloc) {
         _impl->enable_abort_on_bad_alloc();
@@ -2223,9 +2232,10 @@ idle_cpu_handler_result tracker::impl::compact_on_idle(work_waiting_on_reactor c
     }
     segment_pool::reservation_goal open_emergency_pool(shard_segment_pool, 0);
 
-    auto cmp = [] (region::impl* c1, region::impl* c2) {
-        if (c1->is_idle_compactible() != c2->is_idle_compactible()) {
-            return !c1->is_idle_compactible();
+    const auto max_occupancy = _idle_compaction_max_occupancy;
+    auto cmp = [max_occupancy] (region::impl* c1, region::impl* c2) {
+        if (c1->is_idle_compactible(max_occupancy) != c2->is_idle_compactible(max_occupancy)) {
+            return !c1->is_idle_compactible(max_occupancy);
         }
         return c2->min_occupancy() < c1->min_occupancy();
     };
@@ -2236,7 +2246,7 @@ idle_cpu_handler_result tracker::impl::compact_on_idle(work_waiting_on_reactor c
         boost::range::pop_heap(_regions, cmp);
         region::impl* r = _regions.back();
 
-        if (!r->is_idle_compactible()) {
+        if (!r->is_idle_compactible(max_occupancy)) {
             return idle_cpu_handler_result::no_more_work;
         }
 
@@ -418,6 +418,10 @@ public:
 
     struct config {
         bool defragment_on_idle;
+        // Idle defragmentation only compacts regions whose sparsest segment
+        // has occupancy not above this fraction. 1.0 means compact anything
+        // compactible, like reclaim under memory pressure does.
+        float defragment_max_segment_occupancy = 1.0f;
         bool abort_on_lsa_bad_alloc;
         bool sanitizer_report_backtrace = false; // Better reports but slower
         size_t lsa_reclamation_step;
@@ -16,6 +16,9 @@ class evictable {
     using lru_link_type = boost::intrusive::list_member_hook<
         boost::intrusive::link_mode<boost::intrusive::auto_unlink>>;
     lru_link_type _lru_link;
+    // Reference bit for second-chance eviction: set by lru::touch(), consumed
+    // by the eviction scan in exchange for another round through the list.
+    bool _referenced = false;
 protected:
     // Prevent destruction via evictable pointer. LRU is not aware of allocation strategy.
     ~evictable() = default;
@@ -39,44 +42,83 @@ public:
     }
 };
 
+// Implements a scan-resistant, segmented LRU (SLRU) with second-chance
+// (CLOCK-style) promotion. Entries enter a probationary segment; a touch()
+// only sets a reference bit, and the eviction scan does the list work lazily:
+// a referenced entry is moved to the protected segment (probationary) or
+// rotated to its back (protected) with its bit cleared, instead of being
+// evicted. Eviction drains the probationary segment first, so entries which
+// were inserted by a one-pass scan and never touched again cannot displace
+// the repeatedly-touched working set. Keeping the hit path down to a flag
+// write matters more than exact recency order: at high hit rates the list
+// splicing and the neighbour cache-line bouncing of an eager LRU dominate
+// the cost of the cache lookup itself.
 class lru {
 private:
     friend class evictable;
     using lru_type = boost::intrusive::list<evictable,
         boost::intrusive::member_hook<evictable, evictable::lru_link_type, &evictable::_lru_link>,
         boost::intrusive::constant_time_size<false>>; // we need this to have bi::auto_unlink on hooks.
-    lru_type _list;
+    // Entries touched at least once since insertion.
+    lru_type _protected;
+    // Newly inserted entries, evicted before anything in _protected.
+    lru_type _probation;
 public:
     using reclaiming_result = seastar::memory::reclaiming_result;
 
     ~lru() {
-        _list.clear_and_dispose([] (evictable* e) {
+        _probation.clear_and_dispose([] (evictable* e) {
+            e->on_evicted();
+        });
+        _protected.clear_and_dispose([] (evictable* e) {
             e->on_evicted();
         });
     }
 
     void remove(evictable& e) noexcept {
-        _list.erase(_list.iterator_to(e));
+        // auto_unlink hooks leave the right list without us knowing which one it is.
+        e._lru_link.unlink();
     }
 
     void add(evictable& e) noexcept {
-        _list.push_back(e);
+        e._referenced = false;
+        _probation.push_back(e);
     }
 
     void touch(evictable& e) noexcept {
-        remove(e);
-        add(e);
+        // Unlinked entries (held while in active use, or an evicted last
+        // dummy) must be re-linked; everything else just gets its reference
+        // bit set and is promoted lazily by the eviction scan.
+        if (!e._lru_link.is_linked()) {
+            _protected.push_back(e);
+        }
+        e._referenced = true;
     }
 
     // Evicts a single element from the LRU
     reclaiming_result evict() noexcept {
-        if (_list.empty()) {
-            return reclaiming_result::reclaimed_nothing;
+        // Entries touched since they were linked or last scanned get their
+        // reference bit cleared and another round through the list instead of
+        // being evicted. The number of second chances granted per call is
+        // capped so that a single call cannot stall on a fully-referenced
+        // cache; each one is just a couple of pointer splices, and clearing
+        // the bit makes the work amortized across calls.
+        constexpr unsigned max_second_chances = 64;
+        for (unsigned scanned = 0; ; ++scanned) {
+            lru_type& l = _probation.empty() ? _protected : _probation;
+            if (l.empty()) {
+                return reclaiming_result::reclaimed_nothing;
+            }
+            evictable& e = l.front();
+            l.pop_front();
+            if (e._referenced && scanned < max_second_chances) {
+                e._referenced = false;
+                _protected.push_back(e);
+            } else {
+                e.on_evicted();
+                return reclaiming_result::reclaimed_something;
+            }
         }
-        evictable& e = _list.front();
-        _list.pop_front();
-        e.on_evicted();
-        return reclaiming_result::reclaimed_something;
     }
 
     // Evicts all elements.
@@ -87,7 +129,8 @@ public:
 };
 
 inline
-evictable::evictable(evictable&& o) noexcept {
+evictable::evictable(evictable&& o) noexcept
+    : _referenced(o._referenced) {
     if (o._lru_link.is_linked()) {
         auto prev = o._lru_link.prev_;
         o._lru_link.unlink();
@@ -49,6 +49,17 @@ public:
 
 // rapidjson configuration macros
 #define RAPIDJSON_HAS_STDSTRING 1
+// Let rapidjson use vectorized whitespace skipping in its parser when the
+// target instruction set allows it. This covers the string and memory-stream
+// inputs used by rjson::parse(); streams without a SIMD specialization (like
+// our chunked_content_stream) silently fall back to the scalar code.
+#if defined(__SSE4_2__)
+#define RAPIDJSON_SSE42 1
+#elif defined(__SSE2__)
+#define RAPIDJSON_SSE2 1
+#elif defined(__ARM_NEON)
+#define RAPIDJSON_NEON 1
+#endif
 // Default rjson policy is to use assert() - which is dangerous for two reasons:
 // 1. assert() can be turned off with -DNDEBUG
 // 2. assert() crashes a program
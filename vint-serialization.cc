@@ -56,6 +56,11 @@ int64_t signed_vint::deserialize(bytes_view v) {
     return decode_zigzag(un);
 }
 
+int64_t signed_vint::deserialize_with_serialized_size(bytes_view v, vint_size_type size) {
+    const auto un = unsigned_vint::deserialize_with_serialized_size(v, size);
+    return decode_zigzag(un);
+}
+
 vint_size_type signed_vint::serialized_size_from_first_byte(bytes::value_type first_byte) {
     return unsigned_vint::serialized_size_from_first_byte(first_byte);
 }
@@ -105,16 +110,26 @@ vint_size_type unsigned_vint::serialized_size(uint64_t value) noexcept {
 }
 
 uint64_t unsigned_vint::deserialize(bytes_view v) {
+    const int8_t first_byte = *v.data();
+
+    // No additional bytes, since the most significant bit is not set.
+    if (first_byte >= 0) {
+        return uint64_t(first_byte);
+    }
+
+    return deserialize_with_serialized_size(v, 1 + count_extra_bytes(first_byte));
+}
+
+uint64_t unsigned_vint::deserialize_with_serialized_size(bytes_view v, vint_size_type size) {
     auto src = v.data();
     auto len = v.size();
     const int8_t first_byte = *src;
 
-    // No additional bytes, since the most significant bit is not set.
-    if (first_byte >= 0) {
+    if (size == 1) {
         return uint64_t(first_byte);
     }
 
-    const auto extra_bytes_size = count_extra_bytes(first_byte);
+    const auto extra_bytes_size = size - 1;
 
     // Extract the bits not used for counting bytes.
     auto result = uint64_t(first_byte) & first_byte_value_mask(extra_bytes_size);
@@ -49,6 +49,11 @@ struct unsigned_vint final {
 
     static value_type deserialize(bytes_view v);
 
+    // Like deserialize(), but takes the total serialized size, which the
+    // caller typically already knows from serialized_size_from_first_byte().
+    // Skips re-deriving it from the first byte.
+    static value_type deserialize_with_serialized_size(bytes_view v, vint_size_type size);
+
     static vint_size_type serialized_size_from_first_byte(bytes::value_type first_byte);
 };
 
@@ -61,5 +66,8 @@ struct signed_vint final {
 
     static value_type deserialize(bytes_view v);
 
+    // See unsigned_vint::deserialize_with_serialized_size().
+    static value_type deserialize_with_serialized_size(bytes_view v, vint_size_type size);
+
     static vint_size_type serialized_size_from_first_byte(bytes::value_type first_byte);
 };
@@ -12,6 +12,7 @@
 // which are available only when the library is linked statically.
 #define ZSTD_STATIC_LINKING_ONLY
 #include "zstd.h"
+#include "zdict.h"
 
 #include "compress.hh"
 #include "utils/class_registrator.hh"
@@ -31,6 +32,16 @@ class zstd_processor : public compressor {
     std::unique_ptr<char[], free_deleter> _dctx_raw;
     // Decompression context. Observer of _dctx_raw.
     ZSTD_DCtx* _dctx;
+
+    struct cdict_deleter {
+        void operator()(ZSTD_CDict* d) const { ZSTD_freeCDict(d); }
+    };
+    struct ddict_deleter {
+        void operator()(ZSTD_DDict* d) const { ZSTD_freeDDict(d); }
+    };
+    // Shared dictionary, if one was trained for this table. See set_dictionary().
+    std::unique_ptr<ZSTD_CDict, cdict_deleter> _cdict;
+    std::unique_ptr<ZSTD_DDict, ddict_deleter> _ddict;
 public:
     zstd_processor(const opt_getter&);
 
@@ -42,6 +53,11 @@ public:
 
     std::set<sstring> option_names() const override;
     std::map<sstring, sstring> options() const override;
+
+    void set_dictionary(const bytes& dict) override;
+    bool supports_dictionary() const override {
+        return true;
+    }
 };
 
 zstd_processor::zstd_processor(const opt_getter& opts)
@@ -91,7 +107,9 @@ zstd_processor::zstd_processor(const opt_getter& opts)
 }
 
 size_t zstd_processor::uncompress(const char* input, size_t input_len, char* output, size_t output_len) const {
-    auto ret = ZSTD_decompressDCtx(_dctx, output, output_len, input, input_len);
+    auto ret = _ddict
+        ? ZSTD_decompress_usingDDict(_dctx, output, output_len, input, input_len, _ddict.get())
+        : ZSTD_decompressDCtx(_dctx, output, output_len, input, input_len);
     if (ZSTD_isError(ret)) {
         throw std::runtime_error( format("ZSTD decompression failure: {}", ZSTD_getErrorName(ret)));
     }
@@ -100,13 +118,28 @@ size_t zstd_processor::uncompress(const char* input, size_t input_len, char* out
 
 
 size_t zstd_processor::compress(const char* input, size_t input_len, char* output, size_t output_len) const {
-    auto ret = ZSTD_compressCCtx(_cctx, output, output_len, input, input_len, _compression_level);
+    auto ret = _cdict
+        ? ZSTD_compress_usingCDict(_cctx, output, output_len, input, input_len, _cdict.get())
+        : ZSTD_compressCCtx(_cctx, output, output_len, input, input_len, _compression_level);
     if (ZSTD_isError(ret)) {
         throw std::runtime_error( format("ZSTD compression failure: {}", ZSTD_getErrorName(ret)));
     }
     return ret;
 }
 
+void zstd_processor::set_dictionary(const bytes& dict) {
+    auto* cdict = ZSTD_createCDict(dict.data(), dict.size(), _compression_level);
+    if (!cdict) {
+        throw std::runtime_error("Unable to load ZSTD compression dictionary");
+    }
+    _cdict.reset(cdict);
+    auto* ddict = ZSTD_createDDict(dict.data(), dict.size());
+    if (!ddict) {
+        throw std::runtime_error("Unable to load ZSTD decompression dictionary");
+    }
+    _ddict.reset(ddict);
+}
+
 size_t zstd_processor::compress_max_size(size_t input_len) const {
     return ZSTD_compressBound(input_len);
 }
@@ -121,3 +154,35 @@ std::map<sstring, sstring> zstd_processor::options() const {
 
 static const class_registrator<compressor, zstd_processor, const compressor::opt_getter&>
     registrator(COMPRESSOR_NAME);
+
+zstd_dict_trainer::zstd_dict_trainer(size_t max_samples_bytes, size_t max_dict_size)
+    : _max_samples_bytes(max_samples_bytes)
+    , _max_dict_size(max_dict_size)
+{}
+
+bool zstd_dict_trainer::add_sample(bytes_view sample) {
+    if (_sampled_bytes >= _max_samples_bytes) {
+        return false;
+    }
+    _samples.emplace_back(sample.begin(), sample.end());
+    _sampled_bytes += sample.size();
+    return _sampled_bytes < _max_samples_bytes;
+}
+
+bytes zstd_dict_trainer::train() const {
+    bytes flat(bytes::initialized_later(), _sampled_bytes);
+    std::vector<size_t> sizes;
+    sizes.reserve(_samples.size());
+    auto* dst = flat.data();
+    for (const auto& s : _samples) {
+        dst = std::copy(s.begin(), s.end(), dst);
+        sizes.push_back(s.size());
+    }
+    bytes dict(bytes::initialized_later(), _max_dict_size);
+    auto ret = ZDICT_trainFromBuffer(dict.data(), dict.size(), flat.data(), sizes.data(), sizes.size());
+    if (ZDICT_isError(ret)) {
+        throw std::runtime_error(format("ZSTD dictionary training failure: {}", ZDICT_getErrorName(ret)));
+    }
+    dict.resize(ret);
+    return dict;
+}